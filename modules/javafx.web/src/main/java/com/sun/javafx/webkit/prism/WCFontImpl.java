@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -33,11 +33,14 @@ import com.sun.javafx.font.PGFont;
 import com.sun.javafx.geom.transform.BaseTransform;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.scene.text.GlyphList;
 import com.sun.javafx.scene.text.TextLayout;
+import com.sun.javafx.text.TextRun;
 import com.sun.prism.GraphicsPipeline;
 import com.sun.webkit.graphics.WCFont;
-import com.sun.webkit.graphics.WCTextRun;
-import java.util.Arrays;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
 import java.util.HashMap;
 
 final class WCFontImpl extends WCFont {
@@ -109,10 +112,21 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getFontResource().getAdvance(glyph, font.getSize());
     }
 
-    @Override public float[] getGlyphBoundingBox(int glyph) {
-        float[] bb = new float[4];
-        bb = getFontStrike().getFontResource().getGlyphBoundingBox(glyph, font.getSize(), bb);
-        return new float[]{bb[0], -bb[3], bb[2], bb[3] - bb[1]};
+    @Override public void getGlyphWidths(int firstGlyph, int count, ByteBuffer widths) {
+        FontResource fr = getFontStrike().getFontResource();
+        float size = font.getSize();
+        FloatBuffer out = widths.order(ByteOrder.nativeOrder()).asFloatBuffer();
+        for (int i = 0; i < count; i++) {
+            out.put(fr.getAdvance(firstGlyph + i, size));
+        }
+    }
+
+    private final float[] bbox = new float[4];
+
+    @Override public void getGlyphBoundingBox(int glyph, ByteBuffer bounds) {
+        float[] bb = getFontStrike().getFontResource().getGlyphBoundingBox(glyph, font.getSize(), bbox);
+        bounds.order(ByteOrder.nativeOrder()).asFloatBuffer()
+                .put(bb[0]).put(-bb[3]).put(bb[2]).put(bb[3] - bb[1]);
     }
 
     @Override public float getXHeight() {
@@ -202,15 +216,49 @@ final class WCFontImpl extends WCFont {
         return getFontStrike().getMetrics().getCapHeight();
     }
 
+    // Per thread buffer for the shaped runs, grown as needed.
+    private static final ThreadLocal<ByteBuffer> TEXT_RUNS_BUFFER =
+            ThreadLocal.withInitial(() -> ByteBuffer.allocateDirect(4096)
+                    .order(ByteOrder.nativeOrder()));
+
     @Override
-    public WCTextRun[] getTextRuns(final String str) {
+    public ByteBuffer getTextRuns(final String str) {
         if (log.isLoggable(Level.FINE)) {
             log.fine(String.format("str='%s' length=%d", str, str.length()));
         }
 
         final TextLayout layout = TextUtilities.createLayout(str, getPlatformFont());
-        return Arrays.stream(layout.getRuns())
-                     .map(WCTextRunImpl::new)
-                     .toArray(WCTextRunImpl[]::new);
+        final GlyphList[] runs = layout.getRuns();
+
+        int size = Integer.BYTES;
+        for (GlyphList run : runs) {
+            size += (4 + 5 * run.getGlyphCount()) * Integer.BYTES;
+        }
+        ByteBuffer buf = TEXT_RUNS_BUFFER.get();
+        if (buf.capacity() < size) {
+            buf = ByteBuffer.allocateDirect(Math.max(size, buf.capacity() * 2))
+                    .order(ByteOrder.nativeOrder());
+            TEXT_RUNS_BUFFER.set(buf);
+        }
+
+        buf.clear();
+        buf.putInt(runs.length);
+        for (GlyphList glyphList : runs) {
+            final TextRun run = (TextRun) glyphList;
+            final int count = run.getGlyphCount();
+            buf.putInt(run.isLeftToRight() ? 1 : 0)
+               .putInt(run.getStart())
+               .putInt(run.getEnd())
+               .putInt(count);
+            for (int i = 0; i < count; i++) {
+                buf.putInt(run.getGlyphCode(i))
+                   .putInt(run.getCharOffset(i))
+                   .putFloat(run.getPosX(i))
+                   .putFloat(run.getPosY(i))
+                   .putFloat(run.getAdvance(i));
+            }
+        }
+        buf.flip();
+        return buf;
     }
 }
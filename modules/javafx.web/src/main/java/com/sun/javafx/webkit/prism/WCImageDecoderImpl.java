@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,26 +40,48 @@ import com.sun.webkit.graphics.WCImageFrame;
 import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
-import java.util.Arrays;
-import javafx.concurrent.Service;
-import javafx.concurrent.Task;
+import java.nio.ByteBuffer;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.atomic.AtomicInteger;
 
 final class WCImageDecoderImpl extends WCImageDecoder {
 
     private final static PlatformLogger log;
 
-    private Service<ImageFrame[]> loader;
+    // Progressive decoding of partially received images runs on a shared
+    // pool, so that neither the event thread nor the WebCore decoding
+    // queue waits on it.
+    private static final int DECODER_POOL_SIZE =
+            Math.max(1, Math.min(4, Runtime.getRuntime().availableProcessors() / 2));
+    private static final ExecutorService decoderPool;
+    static {
+        final AtomicInteger threadIndex = new AtomicInteger();
+        decoderPool = Executors.newFixedThreadPool(DECODER_POOL_SIZE, r -> {
+            Thread t = new Thread(r, "Image-Decoder-" + threadIndex.getAndIncrement());
+            t.setDaemon(true);
+            return t;
+        });
+    }
+
+    private boolean loaderRunning = false;
+    private int loaderGeneration = 0; // invalidates results of cancelled loaders
 
-    private int imageWidth = 0;
-    private int imageHeight = 0;
+    private volatile int imageWidth = 0;
+    private volatile int imageHeight = 0;
     private ImageFrame[] frames;
     private int frameCount = 0; // keeps frame count when decoded frames are temporarily destroyed
     private boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
     private PrismImage[] images;
+    private int subsampledLevel = 0;
+    private PrismImage[] subsampledImages; // frames decoded at subsampledLevel
+    private int subsamplingGeneration = 0; // invalidates subsampled decodes in progress
+    private boolean subsamplingFailed = false;
+    private static volatile int lastSubsampledWidth = 0; // read by tests
     private volatile byte[] data;
     private volatile int dataSize = 0;
-    private String fileNameExtension;
+    private volatile String fileNameExtension;
 
     static {
         log = PlatformLogger.getLogger(WCImageDecoderImpl.class.getName());
@@ -79,6 +101,8 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         destroyLoader();
         frames = null;
         images = null;
+        subsampledImages = null;
+        subsamplingGeneration++;
         framesDecoded = false;
     }
 
@@ -90,18 +114,20 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    @Override protected void addImageData(ByteBuffer dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
+            int length = dataPortion.remaining();
             if (data == null) {
-                data = Arrays.copyOf(dataPortion, dataPortion.length * 2);
-                dataSize = dataPortion.length;
+                data = new byte[length * 2];
+                dataPortion.get(data, 0, length);
+                dataSize = length;
             } else {
-                int newDataSize = dataSize + dataPortion.length;
+                int newDataSize = dataSize + length;
                 if (newDataSize > data.length) {
                     resizeDataArray(Math.max(newDataSize, data.length * 2));
                 }
-                System.arraycopy(dataPortion, 0, data, dataSize, dataPortion.length);
+                dataPortion.get(data, dataSize, length);
                 dataSize = newDataSize;
             }
             // Try to decode the partial data until we get image size.
@@ -117,35 +143,29 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     }
 
-    private void destroyLoader() {
-        if (loader != null) {
-            loader.cancel();
-            loader = null;
-        }
+    private synchronized void destroyLoader() {
+        loaderGeneration++;
+        loaderRunning = false;
     }
 
-    private void startLoader() {
-        if (this.loader == null) {
-            this.loader = new Service<>() {
-                @Override
-                protected Task<ImageFrame[]> createTask() {
-                    return new Task<>() {
-                        @Override
-                        protected ImageFrame[] call() throws Exception {
-                            return loadFrames();
-                        }
-                    };
+    private synchronized void startLoader() {
+        if (loaderRunning) {
+            return;
+        }
+        loaderRunning = true;
+        final int generation = ++loaderGeneration;
+        decoderPool.execute(() -> {
+            ImageFrame[] loadedFrames = loadFrames();
+            synchronized (WCImageDecoderImpl.this) {
+                if (generation != loaderGeneration) {
+                    return; // destroyed or superseded by a full decode
                 }
-            };
-            this.loader.valueProperty().addListener((ov, old, frames) -> {
-                if ((frames != null) && (loader != null)) {
-                    setFrames(frames);
+                loaderRunning = false;
+                if (loadedFrames != null) {
+                    setFrames(loadedFrames);
                 }
-            });
-        }
-        if (!this.loader.isRunning()) {
-            this.loader.restart();
-        }
+            }
+        });
     }
 
     private void resizeDataArray(int newDataSize) {
@@ -173,12 +193,17 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         setFrames(loadFrames(in));
     }
 
-    private synchronized ImageFrame[] loadFrames(InputStream in) {
+    private ImageFrame[] loadFrames(InputStream in) {
+        return loadFrames(in, 0, 0);
+    }
+
+    private ImageFrame[] loadFrames(InputStream in, int width, int height) {
         if (log.isLoggable(Level.FINE)) {
-            log.fine(String.format("%X Decoding frames", hashCode()));
+            log.fine(String.format("%X Decoding frames %dx%d", hashCode(), width, height));
         }
         try {
-            return ImageStorage.getInstance().loadAll(in, readerListener, 0, 0, true, 1.0f, false);
+            return ImageStorage.getInstance().loadAll(in, readerListener, width, height,
+                    width == 0 && height == 0, 1.0f, width != 0 || height != 0);
         } catch (ImageStorageException e) {
             return null; // consider image missing
         } finally {
@@ -191,7 +216,19 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     }
 
     private ImageFrame[] loadFrames() {
-        return loadFrames(new ByteArrayInputStream(this.data, 0, this.dataSize));
+        return loadFrames(0, 0);
+    }
+
+    private ImageFrame[] loadFrames(int width, int height) {
+        // addImageData() may grow the array concurrently; read the size first
+        // so that it never exceeds the array we end up reading from.
+        int size = this.dataSize;
+        byte[] bytes = this.data;
+        if (bytes == null) {
+            return null;
+        }
+        return loadFrames(new ByteArrayInputStream(bytes, 0, Math.min(size, bytes.length)),
+                width, height);
     }
 
     private final ImageLoadListener readerListener = new ImageLoadListener() {
@@ -287,6 +324,84 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return null;
     }
 
+    // Partial data is only ever shown at full size; subsampled frames are
+    // decoded once all data has arrived.
+    private boolean canSubsample(int subsamplingLevel) {
+        return subsamplingLevel > 0 && fullDataReceived && imageSizeAvilable()
+                && !subsamplingFailed;
+    }
+
+    private boolean hasSubsampledImage(int idx, int subsamplingLevel) {
+        return subsampledImages != null && subsampledLevel == subsamplingLevel
+                && idx >= 0 && idx < subsampledImages.length
+                && subsampledImages[idx] != null;
+    }
+
+    // The scaled decode runs without holding the decoder lock, so that
+    // the main thread isn't blocked asking for the frame size or count
+    // while a decoding thread decodes a large image.
+    @Override protected WCImageFrame getFrame(int idx, int subsamplingLevel) {
+        final int width, height, generation;
+        synchronized (this) {
+            if (!canSubsample(subsamplingLevel)) {
+                return getFrame(idx);
+            }
+            if (subsampledImages != null && subsampledLevel == subsamplingLevel) {
+                return subsampledFrame(subsampledImages, idx, subsamplingLevel);
+            }
+            int scale = 1 << subsamplingLevel;
+            width = (imageWidth + scale - 1) / scale;
+            height = (imageHeight + scale - 1) / scale;
+            generation = subsamplingGeneration;
+        }
+
+        ImageFrame[] scaledFrames = loadFrames(width, height);
+        PrismImage[] scaledImages = null;
+        if (scaledFrames != null) {
+            lastSubsampledWidth = width;
+            scaledImages = new PrismImage[scaledFrames.length];
+            for (int i = 0; i < scaledFrames.length; i++) {
+                if (scaledFrames[i] != null) {
+                    scaledImages[i] = new WCImageImpl(scaledFrames[i]);
+                }
+            }
+        }
+
+        synchronized (this) {
+            if (scaledImages == null) {
+                // Don't try again; getFrameSize() reports the full size from now on
+                subsamplingFailed = true;
+                return getFrame(idx);
+            }
+            // Unless destroyed or superseded meanwhile, keep the frames
+            if (generation == subsamplingGeneration) {
+                subsampledImages = scaledImages;
+                subsampledLevel = subsamplingLevel;
+                subsamplingGeneration++;
+            }
+            return subsampledFrame(scaledImages, idx, subsamplingLevel);
+        }
+    }
+
+    // Falls back to the full size frame if the frame is missing.
+    private synchronized WCImageFrame subsampledFrame(PrismImage[] images, int idx, int subsamplingLevel) {
+        if (idx < 0 || idx >= images.length || images[idx] == null) {
+            return getFrame(idx);
+        }
+        if (log.isLoggable(Level.FINE)) {
+            log.fine(String.format("%X getFrame(%d, %d)", hashCode(), idx, subsamplingLevel));
+        }
+        return new Frame(images[idx], fileNameExtension);
+    }
+
+    /**
+     * Returns the width of the frames most recently decoded at a
+     * subsampling level, or 0 if none were. Used by tests.
+     */
+    static int getLastSubsampledWidth() {
+        return lastSubsampledWidth;
+    }
+
     private synchronized ImageMetadata getFrameMetadata(int idx) {
         return frames != null && frames.length > idx && frames[idx] != null ? frames[idx].getMetadata() : null;
     }
@@ -319,6 +434,27 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return size;
     }
 
+    // Must agree with getFrame(int, int) on whether the frame is subsampled.
+    @Override protected synchronized int[] getFrameSize(int idx, int subsamplingLevel) {
+        if (!canSubsample(subsamplingLevel)) {
+            return getFrameSize(idx);
+        }
+        final int[] size = THREAD_LOCAL_SIZE_ARRAY.get();
+        if (hasSubsampledImage(idx, subsamplingLevel)) {
+            size[0] = subsampledImages[idx].getWidth();
+            size[1] = subsampledImages[idx].getHeight();
+        } else if (subsampledImages == null || subsampledLevel != subsamplingLevel) {
+            // Not decoded at this level yet, report the size it will have
+            int scale = 1 << subsamplingLevel;
+            size[0] = (imageWidth + scale - 1) / scale;
+            size[1] = (imageHeight + scale - 1) / scale;
+        } else {
+            // getFrame() falls back to the full size frame
+            return getFrameSize(idx);
+        }
+        return size;
+    }
+
     @Override protected synchronized boolean getFrameCompleteStatus(int idx) {
         // For GIF images there is no better way to find whether a given frame
         // is completely decoded or not. As of now relying on framesDecoded
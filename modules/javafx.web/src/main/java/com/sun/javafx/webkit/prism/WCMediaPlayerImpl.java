@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,10 @@ package com.sun.javafx.webkit.prism;
 
 import java.net.URI;
 import java.util.List;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.ScheduledFuture;
+import java.util.concurrent.TimeUnit;
 
 import com.sun.javafx.media.PrismMediaFrameHandler;
 import com.sun.media.jfxmedia.Media;
@@ -73,6 +77,20 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
     // 1: at the end (rate > 0); -1: at the begining (rate < 0)
     private int finished = 0;
 
+    // how often the playback position is reported while playing
+    private static final long TIME_UPDATE_INTERVAL = 250_000_000L; // nanos
+    private volatile long lastTimeUpdate = 0;
+    private volatile boolean stalled = false;
+
+    // reports the position while playing, with or without video frames
+    private static final ScheduledExecutorService timeUpdateTimer =
+            Executors.newSingleThreadScheduledExecutor(r -> {
+                Thread t = new Thread(r, "Media-Time-Update");
+                t.setDaemon(true);
+                return t;
+            });
+    private ScheduledFuture<?> timeUpdateTask; // guarded by lock
+
     WCMediaPlayerImpl() {
         frameListener = new MediaFrameListener();
     }
@@ -192,6 +210,7 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
     @Override
     protected void disposePlayer() {
         MediaPlayer old;
+        stopTimeUpdates();
         synchronized (lock) {
             removeListeners();
             old = player;
@@ -249,6 +268,7 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
         MediaPlayer p = getPlayer();
         if (p != null) {
             p.play();
+            updateCurrentTime();
             // workaround: webkit doesn't like late notifications
             notifyPaused(false);
         }
@@ -259,6 +279,7 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
         MediaPlayer p = getPlayer();
         if (p != null) {
             p.pause();
+            updateCurrentTime();
             // workaround: webkit doesn't like late notifications
             notifyPaused(true);
         }
@@ -300,6 +321,7 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
                         }
                         double cur = p.getPresentationTime();
                         if (seekTime < 0.01 || Math.abs(cur) >= 0.01) {
+                            updateCurrentTime();
                             notifySeeking(false, READY_STATE_HAVE_ENOUGH_DATA);
                             break;
                         }
@@ -320,6 +342,39 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
         MediaPlayer p = getPlayer();
         if (p != null) {
             p.setRate(rate);
+            updateCurrentTime();
+        }
+    }
+
+    private void updateCurrentTime() {
+        MediaPlayer p = getPlayer();
+        if (p != null) {
+            float rate = finished != 0 || stalled ? 0f : p.getRate();
+            lastTimeUpdate = System.nanoTime();
+            notifyCurrentTime(getCurrentTime(), rate);
+        }
+    }
+
+    // Corrects the drift of the position extrapolated by webkit from the
+    // last update, which the media clock doesn't report by itself.
+    private void startTimeUpdates() {
+        synchronized (lock) {
+            if (timeUpdateTask == null) {
+                timeUpdateTask = timeUpdateTimer.scheduleWithFixedDelay(() -> {
+                    if (System.nanoTime() - lastTimeUpdate >= TIME_UPDATE_INTERVAL) {
+                        updateCurrentTime();
+                    }
+                }, TIME_UPDATE_INTERVAL, TIME_UPDATE_INTERVAL, TimeUnit.NANOSECONDS);
+            }
+        }
+    }
+
+    private void stopTimeUpdates() {
+        synchronized (lock) {
+            if (timeUpdateTask != null) {
+                timeUpdateTask.cancel(false);
+                timeUpdateTask = null;
+            }
         }
     }
 
@@ -430,24 +485,34 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
     @Override
     public void onPlaying(PlayerStateEvent pse) {
         log.fine("onPlaying");
+        stalled = false;
+        updateCurrentTime();
+        startTimeUpdates();
         notifyPaused(false);
     }
 
     @Override
     public void onPause(PlayerStateEvent pse) {
         log.fine("onPause, time: {0}", pse.getTime());
+        stopTimeUpdates();
+        updateCurrentTime();
         notifyPaused(true);
     }
 
     @Override
     public void onStop(PlayerStateEvent pse) {
         log.fine("onStop");
+        stopTimeUpdates();
+        updateCurrentTime();
         notifyPaused(true);
     }
 
     @Override
     public void onStall(PlayerStateEvent pse) {
         log.fine("onStall");
+        stalled = true;
+        stopTimeUpdates();
+        updateCurrentTime();
     }
 
     @Override
@@ -456,6 +521,8 @@ final class WCMediaPlayerImpl extends WCMediaPlayer
         if (p != null) {
             finished = p.getRate() > 0 ? 1 : -1;
             log.fine("onFinish, time: {0}", pse.getTime());
+            stopTimeUpdates();
+            updateCurrentTime();
             notifyFinished();
         }
     }
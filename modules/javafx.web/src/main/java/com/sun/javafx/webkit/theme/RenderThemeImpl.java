@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -117,7 +117,7 @@ public final class RenderThemeImpl extends RenderTheme {
          * of a control from the pool.
          */
         interface Notifier<T> {
-            public void notifyRemoved(T control);
+            public void notifyRemoved(long id, T control);
         }
 
         Pool(Notifier<T> notifier, Class<T> type) {
@@ -164,7 +164,7 @@ public final class RenderThemeImpl extends RenderTheme {
                     ids.remove(_id);
                     T _control = pool.remove(_id).get();
                     if (_control != null) {
-                        notifier.notifyRemoved(_control);
+                        notifier.notifyRemoved(_id, _control);
                     }
                 // Otherwise, double the pool capacity.
                 } else {
@@ -183,10 +183,10 @@ public final class RenderThemeImpl extends RenderTheme {
                 return;
             }
             ids.clear();
-            for (WeakReference<T> controlRef : pool.values()) {
-                T control = controlRef.get();
+            for (Map.Entry<Long, WeakReference<T>> entry : pool.entrySet()) {
+                T control = entry.getValue().get();
                 if (control != null) {
-                    notifier.notifyRemoved(control);
+                    notifier.notifyRemoved(entry.getKey(), control);
                 }
             }
             pool.clear();
@@ -232,9 +232,11 @@ public final class RenderThemeImpl extends RenderTheme {
 
     public RenderThemeImpl(final Accessor accessor) {
         this.accessor = accessor;
-        pool = new Pool<>(fc -> {
+        pool = new Pool<>((id, fc) -> {
             // Remove the control from WebView when it's removed from the pool.
             accessor.removeChild(fc.asControl());
+            // The widget referring to the removed control can't be drawn anymore.
+            invalidateWidget(id);
         }, FormControl.class);
         accessor.addViewListener(new ViewListener(pool, accessor));
     }
@@ -249,6 +251,15 @@ public final class RenderThemeImpl extends RenderTheme {
         }
     }
 
+    @Override
+    protected void notifyWidgetsUsed(long[] ids) {
+        // Widgets drawn from the native cache don't go through createWidget(),
+        // keep their controls from being evicted as least used.
+        for (long id : ids) {
+            pool.get(id);
+        }
+    }
+
     @Override
     protected Ref createWidget(
         long id,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -75,7 +75,7 @@ public final class ScrollBarThemeImpl extends ScrollBarTheme {
     public ScrollBarThemeImpl(final Accessor accessor) {
         this.accessor = accessor;
         pool = new Pool<>(
-                sb -> {
+                (id, sb) -> {
                     accessor.removeChild(sb);
                 }, ScrollBarWidget.class);
         accessor.addViewListener(new ViewListener(pool, accessor) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,15 +27,19 @@ package com.sun.webkit;
 
 import com.sun.javafx.logging.PlatformLogger;
 import java.io.File;
-import java.io.FileNotFoundException;
 import java.io.IOException;
 import java.io.RandomAccessFile;
 import static java.lang.String.format;
 import java.nio.ByteBuffer;
 import java.nio.channels.FileChannel;
+import java.nio.file.AtomicMoveNotSupportedException;
 import java.nio.file.Files;
 import java.nio.file.InvalidPathException;
+import java.nio.file.LinkOption;
+import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.attribute.BasicFileAttributes;
 
 final class FileSystem {
 
@@ -44,6 +48,12 @@ final class FileSystem {
     private static final int TYPE_FILE = 1;
     private static final int TYPE_DIRECTORY = 2;
 
+    // File type should match native FileType
+    private static final int FILE_TYPE_NONE = -1;
+    private static final int FILE_TYPE_REGULAR = 0;
+    private static final int FILE_TYPE_DIRECTORY = 1;
+    private static final int FILE_TYPE_SYMBOLIC_LINK = 2;
+
     private final static PlatformLogger logger =
             PlatformLogger.getLogger(FileSystem.class.getName());
 
@@ -52,14 +62,24 @@ final class FileSystem {
         throw new AssertionError();
     }
 
+    @SuppressWarnings("removal")
+    private static boolean fwkUseNativeFileAccess() {
+        // Native access would bypass the checks of an installed SecurityManager
+        return System.getSecurityManager() == null;
+    }
+
     private static boolean fwkFileExists(String path) {
         return new File(path).exists();
     }
 
-    private static RandomAccessFile fwkOpenFile(String path, String mode) {
+    private static RandomAccessFile fwkOpenFile(String path, String mode, boolean truncate) {
         try {
-            return new RandomAccessFile(path, mode);
-        } catch (FileNotFoundException | SecurityException ex) {
+            RandomAccessFile raf = new RandomAccessFile(path, mode);
+            if (truncate) {
+                raf.setLength(0);
+            }
+            return raf;
+        } catch (IOException | SecurityException ex) {
             logger.fine(format("Error while creating RandomAccessFile for file [%s]", path), ex);
         }
         return null;
@@ -83,6 +103,35 @@ final class FileSystem {
         return -1;
     }
 
+    private static int fwkWriteToFile(RandomAccessFile raf, ByteBuffer byteBuffer) {
+        try {
+            FileChannel fc = raf.getChannel();
+            return fc.write(byteBuffer);
+        } catch (IOException ex) {
+            logger.fine(format("Error while writing RandomAccessFile for file [%s]", raf), ex);
+        }
+        return -1;
+    }
+
+    private static boolean fwkTruncateFile(RandomAccessFile raf, long length) {
+        try {
+            raf.setLength(length);
+            return true;
+        } catch (IOException ex) {
+            logger.fine(format("Error while truncating RandomAccessFile for file [%s]", raf), ex);
+        }
+        return false;
+    }
+
+    private static long fwkGetFileLength(RandomAccessFile raf) {
+        try {
+            return raf.length();
+        } catch (IOException ex) {
+            logger.fine(format("Error while determining length of RandomAccessFile for file [%s]", raf), ex);
+        }
+        return -1;
+    }
+
     private static void fwkSeekFile(RandomAccessFile raf, long pos) {
         try {
             raf.seek(pos);
@@ -143,4 +192,84 @@ final class FileSystem {
     private static String fwkPathGetFileName(String path) {
         return new File(path).getName();
     }
+
+    private static String fwkParentPath(String path) {
+        return new File(path).getParent();
+    }
+
+    private static String[] fwkListDirectory(String path) {
+        try {
+            return new File(path).list();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error listing directory [%s]", path), ex);
+            return null;
+        }
+    }
+
+    private static int fwkGetFileType(String path, boolean followLinks) {
+        try {
+            BasicFileAttributes attributes = followLinks
+                    ? Files.readAttributes(Paths.get(path), BasicFileAttributes.class)
+                    : Files.readAttributes(Paths.get(path), BasicFileAttributes.class, LinkOption.NOFOLLOW_LINKS);
+            if (attributes.isSymbolicLink()) {
+                return FILE_TYPE_SYMBOLIC_LINK;
+            }
+            return attributes.isDirectory() ? FILE_TYPE_DIRECTORY : FILE_TYPE_REGULAR;
+        } catch (InvalidPathException | IOException | SecurityException ex) {
+            return FILE_TYPE_NONE;
+        }
+    }
+
+    private static boolean fwkDeleteFile(String path) {
+        try {
+            File file = new File(path);
+            return !file.isDirectory() && file.delete();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error deleting file [%s]", path), ex);
+            return false;
+        }
+    }
+
+    private static boolean fwkDeleteEmptyDirectory(String path) {
+        try {
+            // File.delete() fails on directories that are not empty
+            File file = new File(path);
+            return file.isDirectory() && file.delete();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error deleting directory [%s]", path), ex);
+            return false;
+        }
+    }
+
+    private static boolean fwkMoveFile(String oldPath, String newPath) {
+        try {
+            Path source = Paths.get(oldPath);
+            Path target = Paths.get(newPath);
+            try {
+                Files.move(source, target, StandardCopyOption.ATOMIC_MOVE);
+            } catch (AtomicMoveNotSupportedException ex) {
+                Files.move(source, target, StandardCopyOption.REPLACE_EXISTING);
+            }
+            return true;
+        } catch (InvalidPathException | IOException | SecurityException ex) {
+            logger.fine(format("Error moving [%s] to [%s]", oldPath, newPath), ex);
+            return false;
+        }
+    }
+
+    private static boolean fwkHardLinkOrCopyFile(String targetPath, String linkPath) {
+        try {
+            Path target = Paths.get(targetPath);
+            Path link = Paths.get(linkPath);
+            try {
+                Files.createLink(link, target);
+            } catch (UnsupportedOperationException | IOException ex) {
+                Files.copy(target, link);
+            }
+            return true;
+        } catch (InvalidPathException | IOException | SecurityException ex) {
+            logger.fine(format("Error linking [%s] to [%s]", linkPath, targetPath), ex);
+            return false;
+        }
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,17 +25,50 @@
 
 package com.sun.webkit;
 
+import java.util.concurrent.ScheduledThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+
 /**
  * The class reflects the native webkit module.
  */
 final class MainThread {
 
+    // Delays the RunLoop timer callbacks, which are then run on the event thread.
+    private static final ScheduledThreadPoolExecutor timerScheduler =
+            new ScheduledThreadPoolExecutor(1, r -> {
+                Thread t = new Thread(r, "WebKit-RunLoop-Timer");
+                t.setDaemon(true);
+                return t;
+            });
+
     private static void fwkScheduleDispatchFunctions() {
         Invoker.getInvoker().postOnEventThread(() -> {
             twkScheduleDispatchFunctions();
         });
     }
 
+    /**
+     * Called when the earliest timer of the native main RunLoop changes.
+     *
+     * @param delay time to wait in milliseconds
+     */
+    private static void fwkScheduleTimers(long delay) {
+        Runnable fire = () -> Invoker.getInvoker().postOnEventThread(() -> {
+            WebPage.lockPage();
+            try {
+                twkFireTimers();
+            } finally {
+                WebPage.unlockPage();
+            }
+        });
+        if (delay > 0) {
+            timerScheduler.schedule(fire, delay, TimeUnit.MILLISECONDS);
+        } else {
+            fire.run();
+        }
+    }
+
     private static native void twkScheduleDispatchFunctions();
+    private static native void twkFireTimers();
     static native void twkSetShutdown(boolean isShutdown);
 }
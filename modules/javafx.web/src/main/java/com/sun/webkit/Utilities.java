@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -92,6 +92,26 @@ public abstract class Utilities {
         "sun.misc"
     );
 
+    // Whether the methods of a class may be invoked, computed once per class
+    // as scripts may call the same Java methods many times
+    private static final ClassValue<Boolean> INVOCATION_ALLOWED = new ClassValue<>() {
+        @Override
+        protected Boolean computeValue(Class<?> clazz) {
+            // check list of rejected class names
+            final String className = clazz.getName();
+            if (CLASSES_REJECT_LIST.contains(className)) {
+                return false;
+            }
+            // check list of rejected packages
+            for (String packageName : PACKAGES_REJECT_LIST) {
+                if (className.startsWith(packageName + ".")) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
     @SuppressWarnings("removal")
     private static Object fwkInvokeWithContext(final Method method,
                                                final Object instance,
@@ -105,18 +125,8 @@ public abstract class Utilities {
             if (!CLASS_METHODS_ALLOW_LIST.contains(method.getName())) {
                 throw new UnsupportedOperationException("invocation not supported");
             }
-        } else {
-            // check list of rejected class names
-            final String className = clazz.getName();
-            if (CLASSES_REJECT_LIST.contains(className)) {
-                throw new UnsupportedOperationException("invocation not supported");
-            }
-            // check list of rejected packages
-            PACKAGES_REJECT_LIST.forEach(packageName -> {
-                if (className.startsWith(packageName + ".")) {
-                    throw new UnsupportedOperationException("invocation not supported");
-                }
-            });
+        } else if (!INVOCATION_ALLOWED.get(clazz)) {
+            throw new UnsupportedOperationException("invocation not supported");
         }
 
         try {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,7 @@ import com.sun.webkit.event.WCMouseEvent;
 import com.sun.webkit.event.WCMouseWheelEvent;
 import com.sun.webkit.graphics.*;
 import com.sun.webkit.network.CookieManager;
+import com.sun.webkit.network.NetworkContext;
 import static com.sun.webkit.network.URLs.newURL;
 import java.net.CookieHandler;
 import java.net.MalformedURLException;
@@ -152,6 +153,10 @@ public final class WebPage {
                     "com.sun.webkit.useJIT", "true"));
             final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
                     "com.sun.webkit.useDFGJIT", "false"));
+            // FTL is only built on Linux x86-64 and, like DFG, tiers up
+            // from it, so it is only used when DFG is enabled as well.
+            final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                    "com.sun.webkit.useFTLJIT", "true"));
 
             // TODO: Enable CSS3D by default once it is stabilized.
             boolean useCSS3D = Boolean.valueOf(System.getProperty(
@@ -159,7 +164,7 @@ public final class WebPage {
             useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
 
             // Initialize WTF, WebCore and JavaScriptCore.
-            twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+            twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useCSS3D);
 
             // Inform the native webkit code when either the JVM or the
             // JavaFX runtime is being shutdown
@@ -265,6 +270,9 @@ public final class WebPage {
 
     private WCPageBackBuffer backbuffer;
     private List<WCRectangle> dirtyRects = new LinkedList<>();
+    // Set when the dirty rects do not come from the native code only, so
+    // the native painting may not be limited to the damage it has tracked
+    private boolean fullRepaintPending = true;
 
     private void addDirtyRect(WCRectangle toPaint) {
         if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
@@ -322,15 +330,21 @@ public final class WebPage {
         }
         List<WCRectangle> oldDirtyRects = dirtyRects;
         dirtyRects = new LinkedList<>();
-        twkPrePaint(getPage());
+        // A transparent page clears the whole rect of a queue before
+        // decoding, see paint2GC()
+        boolean fullRepaint = fullRepaintPending || isBackgroundColorTransparent();
+        fullRepaintPending = false;
+        twkPrePaint(getPage(), fullRepaint);
         while (!oldDirtyRects.isEmpty()) {
             WCRectangle r = oldDirtyRects.remove(0).intersection(clip);
             if (r.getWidth() <= 0 || r.getHeight() <= 0) {
                 continue;
             }
             paintLog.finest("Updating: {0}", r);
+            // Unless repainting fully, only the damaged part of the rect
+            // is painted, so the queue may not replace previous frames
             WCRenderQueue rq = WCGraphicsManager.getGraphicsManager()
-                    .createRenderQueue(r, true);
+                    .createRenderQueue(r, fullRepaint);
             twkUpdateContent(getPage(), rq, r.getIntX() - 1, r.getIntY() - 1,
                              r.getIntWidth() + 2, r.getIntHeight() + 2);
             currentFrame.addRenderQueue(rq);
@@ -348,6 +362,11 @@ public final class WebPage {
             paintLog.finest("Dirty rects processed, dirtyRects: {0}, currentFrame: {1}",
                     new Object[] {dirtyRects, currentFrame});
         }
+        if (paintLog.isLoggable(Level.FINE)) {
+            paintLog.fine("Frame encoded: {0} bytes, {1} ops, {2} elided ops",
+                    new Object[] {currentFrame.getSize(), currentFrame.getOpCount(),
+                                  currentFrame.getElidedOpCount()});
+        }
 
         if (currentFrame.getRQList().size() > 0) {
             synchronized (frameQueue) {
@@ -484,6 +503,33 @@ public final class WebPage {
             return enclosingRect;
         }
 
+        // Called on: Event thread only
+        private int getSize() {
+            int size = 0;
+            for (WCRenderQueue rq : rqList) {
+                size += rq.getSize();
+            }
+            return size;
+        }
+
+        // Called on: Event thread only
+        private int getOpCount() {
+            int count = 0;
+            for (WCRenderQueue rq : rqList) {
+                count += rq.getOpCount();
+            }
+            return count;
+        }
+
+        // Called on: Event thread only
+        private int getElidedOpCount() {
+            int count = 0;
+            for (WCRenderQueue rq : rqList) {
+                count += rq.getElidedOpCount();
+            }
+            return count;
+        }
+
         // Called on: Event thread only
         private void drop() {
             for (WCRenderQueue rq : rqList) {
@@ -1287,6 +1333,7 @@ public final class WebPage {
             if (!frames.contains(frameID)) {
                 return;
             }
+            NetworkContext.updateHTTPCacheConfiguration();
             if (twkIsLoading(frameID)) {
                 Invoker.getInvoker().postOnEventThread(() -> {
                     // Postpone new load request while webkit is
@@ -1316,6 +1363,7 @@ public final class WebPage {
             if (!frames.contains(frameID)) {
                 return;
             }
+            NetworkContext.updateHTTPCacheConfiguration();
             // TODO: handle contentType
             if (twkIsLoading(frameID)) {
                 // Postpone loading new content while webkit is
@@ -2107,6 +2155,49 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the directory the IndexedDB databases of this page are stored
+     * in. The page uses the directory that is set when it first opens a
+     * database, pages with the same directory share the databases. The
+     * page cache of each database can be sized with the
+     * {@code com.sun.webkit.indexedDB.pageCacheSize} system property, in
+     * bytes.
+     */
+    public void setIndexedDatabaseDirectory(String path) {
+        @SuppressWarnings("removal")
+        long pageCacheSize = AccessController.doPrivileged(
+                (PrivilegedAction<Long>) () -> Long.getLong("com.sun.webkit.indexedDB.pageCacheSize", 0L));
+        lockPage();
+        try {
+            twkSetIndexedDatabaseDirectory(getPage(), path, pageCacheSize);
+        } finally {
+            unlockPage();
+        }
+    }
+
+    /**
+     * Returns whether the bytecode of external scripts is cached on disk,
+     * which is enabled with the {@code com.sun.webkit.bytecodeCache}
+     * system property.
+     */
+    public static boolean isBytecodeCacheEnabled() {
+        @SuppressWarnings("removal")
+        boolean enabled = AccessController.doPrivileged(
+                (PrivilegedAction<Boolean>) () -> Boolean.getBoolean("com.sun.webkit.bytecodeCache"));
+        return enabled;
+    }
+
+    /**
+     * Sets the directory the bytecode of external scripts is cached in, so
+     * that repeated loads skip parsing and bytecode generation. The cache
+     * is shared by all pages, like the scripts in the memory cache: the
+     * first directory set is used by every page of the process, and later
+     * calls have no effect.
+     */
+    public static void setBytecodeCacheDirectory(String path) {
+        twkSetBytecodeCacheDirectory(path);
+    }
+
     // ---- INSPECTOR SUPPORT ---- //
 
     public void connectInspectorFrontend() {
@@ -2587,6 +2678,7 @@ public final class WebPage {
     }
 
     private void repaintAll() {
+        fullRepaintPending = true;
         dirtyRects.clear();
         addDirtyRect(new WCRectangle(0, 0, width, height));
     }
@@ -2617,11 +2709,28 @@ public final class WebPage {
         return frames.size();
     }
 
+    // Package scope methods for testing
+    static int test_getBytecodeCacheRetrievedCount() {
+        return twkGetBytecodeCacheRetrievedCount();
+    }
+
+    static void test_deleteAllJSCode() {
+        twkDeleteAllJSCode();
+    }
+
+    static void test_startRunLoopTest(int repeatCount) {
+        twkStartRunLoopTest(repeatCount);
+    }
+
+    static int[] test_getRunLoopTestResults() {
+        return twkGetRunLoopTestResults();
+    }
+
     // *************************************************************************
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useFTLJIT, boolean useCSS3D);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2679,7 +2788,7 @@ public final class WebPage {
     private native void twkSetBackgroundColor(long pFrame, int backgroundColor);
 
     private native void twkSetBounds(long pPage, int x, int y, int w, int h);
-    private native void twkPrePaint(long pPage);
+    private native void twkPrePaint(long pPage, boolean fullRepaint);
     private native void twkUpdateContent(long pPage, WCRenderQueue rq, int x, int y, int w, int h);
     private native void twkUpdateRendering(long pPage);
     private native void twkPostPaint(long pPage, WCRenderQueue rq,
@@ -2743,6 +2852,8 @@ public final class WebPage {
     private native void twkSetUserAgent(long page, String userAgent);
     private native void twkSetLocalStorageDatabasePath(long page, String path);
     private native void twkSetLocalStorageEnabled(long page, boolean enabled);
+    private native void twkSetIndexedDatabaseDirectory(long page, String path, long pageCacheSize);
+    private static native void twkSetBytecodeCacheDirectory(String path);
 
     private native int twkGetUnloadEventListenersCount(long pFrame);
 
@@ -2751,4 +2862,8 @@ public final class WebPage {
     private native void twkDispatchInspectorMessageFromFrontend(long pPage,
                                                                 String message);
     private static native void twkDoJSCGarbageCollection();
+    private static native int twkGetBytecodeCacheRetrievedCount();
+    private static native void twkDeleteAllJSCode();
+    private static native void twkStartRunLoopTest(int repeatCount);
+    private static native int[] twkGetRunLoopTestResults();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -302,14 +302,18 @@ public final class GraphicsDecoder  {
                         buf.getInt(), buf.getInt(),     // from and to positions
                         buf.getFloat(), buf.getFloat());// (x,y) position
                     break;
-                case DRAWSTRING_FAST:
+                case DRAWSTRING_FAST: {
+                    WCFont font = (WCFont) gm.getRef(buf.getInt());
+                    float x = buf.getFloat();
+                    float y = buf.getFloat();
+                    int count = buf.getInt();
                     gc.drawString(
-                        (WCFont) gm.getRef(buf.getInt()),
-                        bdata.getIntArray(buf.getInt()), //glyphs
-                        bdata.getFloatArray(buf.getInt()), //offsets
-                        buf.getFloat(),
-                        buf.getFloat());
+                        font,
+                        getIntArray(buf, count), //glyphs
+                        getFloatArray(buf, count), //advances
+                        x, y);
                     break;
+                }
                 case DRAWWIDGET:
                     gc.drawWidget((RenderTheme)(gm.getRef(buf.getInt())),
                         gm.getRef(buf.getInt()), buf.getInt(), buf.getInt());
@@ -453,13 +457,25 @@ public final class GraphicsDecoder  {
     }
 
     private static float[] getFloatArray(ByteBuffer buf) {
-        float[] array = new float[buf.getInt()];
+        return getFloatArray(buf, buf.getInt());
+    }
+
+    private static float[] getFloatArray(ByteBuffer buf, int length) {
+        float[] array = new float[length];
         for (int i = 0; i < array.length; i++) {
             array[i] = buf.getFloat();
         }
         return array;
     }
 
+    private static int[] getIntArray(ByteBuffer buf, int length) {
+        int[] array = new int[length];
+        for (int i = 0; i < array.length; i++) {
+            array[i] = buf.getInt();
+        }
+        return array;
+    }
+
     private static WCPath getPath(WCGraphicsManager gm, ByteBuffer buf) {
         WCPath path = (WCPath) gm.getRef(buf.getInt());
         path.setWindingRule(buf.getInt());
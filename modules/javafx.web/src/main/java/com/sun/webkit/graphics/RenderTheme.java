@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -61,4 +61,40 @@ public abstract class RenderTheme extends Ref {
     protected abstract int getSelectionColor(int index);
 
     public abstract WCSize getWidgetSize(Ref widget);
+
+    /**
+     * Drops the widget of the object with the given ID from the native
+     * widget cache. Must be called when a widget returned by
+     * {@code createWidget} can no longer be drawn, e.g. because its
+     * control was disposed.
+     */
+    protected final void invalidateWidget(long id) {
+        twkInvalidateWidget(getID(), id);
+    }
+
+    /**
+     * Called before {@code createWidget} with the IDs of the objects
+     * whose widgets were drawn from the native cache since the last call,
+     * least recently used first.
+     */
+    protected void notifyWidgetsUsed(long[] ids) {
+    }
+
+    /**
+     * Returns the number of widget paints served from the native cache.
+     */
+    public static long getWidgetCacheHits() {
+        return twkGetWidgetCacheHits();
+    }
+
+    /**
+     * Returns the number of widget paints that called {@code createWidget}.
+     */
+    public static long getWidgetCacheMisses() {
+        return twkGetWidgetCacheMisses();
+    }
+
+    private static native void twkInvalidateWidget(int themeID, long id);
+    private static native long twkGetWidgetCacheHits();
+    private static native long twkGetWidgetCacheMisses();
 }
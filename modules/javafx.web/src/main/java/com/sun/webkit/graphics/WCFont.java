@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,13 +25,28 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
+
 public abstract class WCFont extends Ref {
 
     public abstract Object getPlatformFont();
 
     public abstract WCFont deriveFont(float size);
 
-    public abstract WCTextRun[] getTextRuns(String str);
+    /**
+     * Shapes the string and returns all its runs packed into a direct
+     * buffer in native byte order:
+     * <pre>
+     *   int runCount
+     *   runCount times:
+     *     int flags (1 if left to right), int start, int end, int glyphCount
+     *     glyphCount times:
+     *       int glyph, int charOffset, float x, float y, float advance
+     * </pre>
+     * The buffer may be reused by the next call on the same thread.
+     * NB: This method is called from native code!
+     */
+    public abstract ByteBuffer getTextRuns(String str);
 
     public abstract int[] getGlyphCodes(char[] chars);
 
@@ -39,7 +54,19 @@ public abstract class WCFont extends Ref {
 
     public abstract double getGlyphWidth(int glyph);
 
-    public abstract float[] getGlyphBoundingBox(int glyph);
+    /**
+     * Writes the advances of {@code count} glyphs starting from
+     * {@code firstGlyph} to the buffer, one float per glyph.
+     * NB: This method is called from native code!
+     */
+    public abstract void getGlyphWidths(int firstGlyph, int count, ByteBuffer widths);
+
+    /**
+     * Writes the bounding box of the glyph to the buffer
+     * as four floats: x, y, width and height.
+     * NB: This method is called from native code!
+     */
+    public abstract void getGlyphBoundingBox(int glyph, ByteBuffer bounds);
 
     /**
      * Returns a hash code value for the object.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -90,6 +90,12 @@ public abstract class WCGraphicsManager {
 
     protected abstract WCPath createWCPath(WCPath path);
 
+    private WCPath fwkCreateWCPath(ByteBuffer segments) {
+        WCPath path = createWCPath();
+        path.addSegments(segments);
+        return path;
+    }
+
     protected abstract WCImage createWCImage(int w, int h);
 
     protected abstract WCImage createRTImage(int w, int h);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,16 +25,20 @@
 
 package com.sun.webkit.graphics;
 
+import java.nio.ByteBuffer;
 
 public abstract class WCImageDecoder {
 
     /**
      * Receives a portion of image data.
      *
+     * The buffer may wrap native memory and is only valid
+     * for the duration of the call.
+     *
      * @param data  a portion of image data,
      *              or {@code null} if all data received
      */
-    protected abstract void addImageData(byte[] data);
+    protected abstract void addImageData(ByteBuffer data);
 
     /**
      * Returns image size.
@@ -54,6 +58,17 @@ public abstract class WCImageDecoder {
      */
     protected abstract WCImageFrame getFrame(int index);
 
+    /**
+     * Returns image frame at the specified index, decoded at
+     * {@code 1 / 2^subsamplingLevel} of its size. May be called
+     * on a decoding thread other than the event thread.
+     * @param index frame index
+     * @param subsamplingLevel subsampling level, 0 for full size
+     */
+    protected WCImageFrame getFrame(int index, int subsamplingLevel) {
+        return getFrame(index);
+    }
+
     /**
      * Returns frame duration in ms
      * @param index frame index
@@ -67,6 +82,17 @@ public abstract class WCImageDecoder {
      */
     protected abstract int[] getFrameSize(int index);
 
+    /**
+     * Returns the size of the frame returned by
+     * {@link #getFrame(int, int)} for the same arguments, array[0]
+     * represents width and array[1] represents height.
+     * @param index frame index
+     * @param subsamplingLevel subsampling level, 0 for full size
+     */
+    protected int[] getFrameSize(int index, int subsamplingLevel) {
+        return getFrameSize(index);
+    }
+
     /**
      * Returns whether the frame is complete or partial
      * @param index frame index
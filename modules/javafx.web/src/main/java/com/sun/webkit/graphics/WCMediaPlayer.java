@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -246,6 +246,23 @@ public abstract class WCMediaPlayer extends Ref {
         });
     }
 
+    /**
+     * Reports the playback position. WebKit advances the position from it at
+     * {@code rate} while playing instead of calling {@link #getCurrentTime()},
+     * so it must be reported whenever the playback clock is (re)started,
+     * stopped or adjusted, and periodically while playing to limit drift.
+     */
+    protected void notifyCurrentTime(float time, float rate) {
+        final float _time = time;
+        final float _rate = rate;
+        final long sampleTime = System.nanoTime();
+        Invoker.getInvoker().invokeOnEventThread(() -> {
+            if (nPtr != 0) {
+                notifyCurrentTime(nPtr, _time, _rate, System.nanoTime() - sampleTime);
+            }
+        });
+    }
+
 
     /* ======================================= */
     /*  Methods called from webkit             */
@@ -351,5 +368,6 @@ public abstract class WCMediaPlayer extends Ref {
     private native void notifySizeChanged(long nPtr, int width, int height);
     private native void notifyNewFrame(long nPtr);
     private native void notifyBufferChanged(long nPtr, float[] ranges, int bytesLoaded);
+    private native void notifyCurrentTime(long nPtr, float time, float rate, long ageNanos);
 
 }
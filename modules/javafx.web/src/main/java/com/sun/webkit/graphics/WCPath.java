@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,8 @@
 package com.sun.webkit.graphics;
 
 import java.lang.annotation.Native;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 
 public abstract class WCPath<P> extends Ref {
 
@@ -53,6 +55,14 @@ public abstract class WCPath<P> extends Ref {
      */
     @Native public static final int RULE_EVENODD = 1;
 
+    /* Segment types that may appear in a packed segment buffer in addition
+     * to the WCPathIterator ones. Arcs and ellipses are kept as is so that
+     * they get flattened the same way as when they are added one by one.
+     */
+    @Native public static final int SEG_ARCTO = 5;
+    @Native public static final int SEG_ARC = 6;
+    @Native public static final int SEG_ELLIPSE = 7;
+
     public abstract void addRect(double x, double y, double w, double h);
 
     public abstract void addEllipse(double x, double y, double w, double h);
@@ -98,6 +108,89 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract WCPathIterator getPathIterator();
 
+    /**
+     * Appends the segments packed into the given buffer. Each segment is
+     * an int type followed by its float arguments, in native byte order.
+     */
+    public void addSegments(ByteBuffer segments) {
+        segments.order(ByteOrder.nativeOrder());
+        while (segments.hasRemaining()) {
+            int type = segments.getInt();
+            switch (type) {
+                case WCPathIterator.SEG_MOVETO:
+                    moveTo(segments.getFloat(), segments.getFloat());
+                    break;
+                case WCPathIterator.SEG_LINETO:
+                    addLineTo(segments.getFloat(), segments.getFloat());
+                    break;
+                case WCPathIterator.SEG_QUADTO:
+                    addQuadCurveTo(segments.getFloat(), segments.getFloat(),
+                                   segments.getFloat(), segments.getFloat());
+                    break;
+                case WCPathIterator.SEG_CUBICTO:
+                    addBezierCurveTo(segments.getFloat(), segments.getFloat(),
+                                     segments.getFloat(), segments.getFloat(),
+                                     segments.getFloat(), segments.getFloat());
+                    break;
+                case WCPathIterator.SEG_CLOSE:
+                    closeSubpath();
+                    break;
+                case SEG_ARCTO:
+                    addArcTo(segments.getFloat(), segments.getFloat(),
+                             segments.getFloat(), segments.getFloat(),
+                             segments.getFloat());
+                    break;
+                case SEG_ARC:
+                    addArc(segments.getFloat(), segments.getFloat(),
+                           segments.getFloat(), segments.getFloat(),
+                           segments.getFloat(), segments.getInt() != 0);
+                    break;
+                case SEG_ELLIPSE:
+                    addEllipse(segments.getFloat(), segments.getFloat(),
+                               segments.getFloat(), segments.getFloat());
+                    break;
+                default:
+                    throw new IllegalArgumentException("Unknown segment type " + type);
+            }
+        }
+    }
+
+    /**
+     * Returns the segments of this path packed the same way as for
+     * {@link #addSegments}, using the WCPathIterator segment types only.
+     */
+    public ByteBuffer getSegments() {
+        double[] coords = new double[6];
+        int size = 0;
+        for (WCPathIterator pi = getPathIterator(); !pi.isDone(); pi.next()) {
+            size += 4 + 4 * coordCount(pi.currentSegment(coords));
+        }
+        ByteBuffer segments = ByteBuffer.allocateDirect(size)
+                .order(ByteOrder.nativeOrder());
+        for (WCPathIterator pi = getPathIterator(); !pi.isDone(); pi.next()) {
+            int type = pi.currentSegment(coords);
+            segments.putInt(type);
+            for (int i = 0; i < coordCount(type); i++) {
+                segments.putFloat((float) coords[i]);
+            }
+        }
+        return segments.flip();
+    }
+
+    private static int coordCount(int type) {
+        switch (type) {
+            case WCPathIterator.SEG_MOVETO:
+            case WCPathIterator.SEG_LINETO:
+                return 2;
+            case WCPathIterator.SEG_QUADTO:
+                return 4;
+            case WCPathIterator.SEG_CUBICTO:
+                return 6;
+            default:
+                return 0;
+        }
+    }
+
     public abstract boolean strokeContains(double x, double y,
                                            double thickness, double miterLimit,
                                            int cap, int join, double dashOffset,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,6 +44,8 @@ public abstract class WCRenderQueue extends Ref {
     private BufferData currentBuffer = new BufferData();
     private final WCRectangle clip;
     private int size = 0;
+    private int opCount = 0;
+    private int elidedOpCount = 0;
     private final boolean opaque;
 
     // Associated graphics context (currently used to draw to a buffered image).
@@ -65,6 +67,22 @@ public abstract class WCRenderQueue extends Ref {
         return size;
     }
 
+    /**
+     * Returns the number of operations encoded to the queue since
+     * the last {@code dispose()}.
+     */
+    public synchronized int getOpCount() {
+        return opCount;
+    }
+
+    /**
+     * Returns the number of redundant state changes that were not
+     * encoded to the queue since the last {@code dispose()}.
+     */
+    public synchronized int getElidedOpCount() {
+        return elidedOpCount;
+    }
+
     public synchronized void addBuffer(ByteBuffer buffer) {
         if (log.isLoggable(Level.FINE) && buffers.isEmpty()) {
             log.fine("'{'WCRenderQueue{0}[{1}]",
@@ -73,7 +91,7 @@ public abstract class WCRenderQueue extends Ref {
         currentBuffer.setBuffer(buffer);
         buffers.addLast(currentBuffer);
         currentBuffer = new BufferData();
-        size += buffer.capacity();
+        size += buffer.remaining();
         if (size > MAX_QUEUE_SIZE && gc!=null) {
             // It is isolated queue over the canvas image [image-gc!=null].
             // We need to flush the changes periodically
@@ -127,7 +145,14 @@ public abstract class WCRenderQueue extends Ref {
         flush();
     }
 
-    private void fwkAddBuffer(ByteBuffer buffer) {
+    private synchronized void fwkAddBuffer(ByteBuffer buffer, int length,
+                                           int ops, int elidedOps)
+    {
+        // Native buffers are recycled, so the same buffer may come
+        // with a different amount of data.
+        buffer.clear().limit(length);
+        opCount += ops;
+        elidedOpCount += elidedOps;
         addBuffer(buffer);
     }
 
@@ -148,6 +173,8 @@ public abstract class WCRenderQueue extends Ref {
                 twkRelease(arr);
             });
             size = 0;
+            opCount = 0;
+            elidedOpCount = 0;
             if (log.isLoggable(Level.FINE)) {
                 log.fine("'}'WCRenderQueue{0}[{1}]",
                         new Object[]{hashCode(), idCountObj.decrementAndGet()});
@@ -168,16 +195,6 @@ public abstract class WCRenderQueue extends Ref {
         return currentBuffer.addString(str);
     }
 
-    /*is called from native*/
-    private int refIntArr(int[] arr) {
-        return currentBuffer.addIntArray(arr);
-    }
-
-    /*is called from native*/
-    private int refFloatArr(float[] arr) {
-        return currentBuffer.addFloatArray(arr);
-    }
-
     public boolean isOpaque() {
         return opaque;
     }
@@ -186,6 +203,8 @@ public abstract class WCRenderQueue extends Ref {
         return "WCRenderQueue{"
                 + "clip=" + clip + ", "
                 + "size=" + size + ", "
+                + "ops=" + opCount + ", "
+                + "elidedOps=" + elidedOpCount + ", "
                 + "opaque=" + opaque
                 + "}";
     }
@@ -196,10 +215,6 @@ final class BufferData {
     private final AtomicInteger idCount = new AtomicInteger(0);
     private final HashMap<Integer,String> strMap =
             new HashMap<>();
-    private final HashMap<Integer,int[]> intArrMap =
-            new HashMap<>();
-    private final HashMap<Integer,float[]> floatArrMap =
-            new HashMap<>();
 
     private ByteBuffer buffer;
 
@@ -207,26 +222,6 @@ final class BufferData {
         return idCount.incrementAndGet();
     }
 
-    int addIntArray(int[] a) {
-        int id = createID();
-        intArrMap.put(id, a);
-        return id;
-    }
-
-    int[] getIntArray(int id) {
-        return intArrMap.get(id);
-    }
-
-    int addFloatArray(float[] a) {
-        int id = createID();
-        floatArrMap.put(id, a);
-        return id;
-    }
-
-    float[] getFloatArray(int id) {
-        return floatArrMap.get(id);
-    }
-
     int addString(String s) {
         int id = createID();
         strMap.put(id, s);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,7 +32,9 @@ import java.util.concurrent.Semaphore;
 
 /**
  * A pool of byte buffers that can be shared by multiple concurrent
- * clients.
+ * clients. The buffers are native segments allocated with
+ * {@link URLLoaderBase#twkAllocateSegment}, so that a filled buffer can
+ * be handed over to the native code without copying.
  */
 final class ByteBufferPool {
 
@@ -102,7 +104,7 @@ final class ByteBufferPool {
             semaphore.acquire();
             ByteBuffer byteBuffer = byteBuffers.poll();
             if (byteBuffer == null) {
-                byteBuffer = ByteBuffer.allocateDirect(bufferSize);
+                byteBuffer = URLLoaderBase.twkAllocateSegment(bufferSize);
             }
             return byteBuffer;
         }
@@ -116,6 +118,14 @@ final class ByteBufferPool {
             byteBuffers.add(byteBuffer);
             semaphore.release();
         }
+
+        /**
+         * {@inheritDoc}
+         */
+        @Override
+        public void detach(ByteBuffer byteBuffer) {
+            semaphore.release();
+        }
     }
 }
 
@@ -133,4 +143,10 @@ interface ByteBufferAllocator {
      * Releases a byte buffer.
      */
     void release(ByteBuffer byteBuffer);
+
+    /**
+     * Releases a byte buffer whose memory has been handed over to
+     * the native code. The buffer is not returned to the pool.
+     */
+    void detach(ByteBuffer byteBuffer);
 }
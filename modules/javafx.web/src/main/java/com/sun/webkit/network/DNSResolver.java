@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import com.sun.javafx.logging.PlatformLogger;
+import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.webkit.Invoker;
+import java.net.InetAddress;
+import java.net.Proxy;
+import java.net.ProxySelector;
+import java.net.URI;
+import java.net.UnknownHostException;
+import java.security.AccessController;
+import java.security.PrivilegedAction;
+import java.security.PrivilegedActionException;
+import java.security.PrivilegedExceptionAction;
+import java.security.Security;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Resolves host names on behalf of WebCore's DNS prefetching and
+ * {@code resolveDNS()}. Lookups run on a small thread pool and their
+ * results are cached for the time configured by the
+ * {@code networkaddress.cache.ttl} and
+ * {@code networkaddress.cache.negative.ttl} security properties, the same
+ * policy that applies to the JDK's own address cache. Resolving through
+ * {@link InetAddress} also fills that cache, so a later connection to
+ * a prefetched host made by {@link URLLoader} or {@link HTTP2Loader}
+ * does not wait for DNS.
+ */
+final class DNSResolver {
+
+    private static final PlatformLogger logger =
+            PlatformLogger.getLogger(DNSResolver.class.getName());
+
+    /**
+     * Resolves a host name to its addresses.
+     */
+    @FunctionalInterface
+    interface Resolver {
+        InetAddress[] resolve(String host) throws UnknownHostException;
+    }
+
+    /**
+     * The number of threads resolving names concurrently.
+     */
+    private static final int THREAD_POOL_SIZE = 4;
+
+    /**
+     * The maximum number of lookups waiting for a thread.
+     */
+    private static final int MAX_QUEUED_LOOKUPS = 64;
+
+    /**
+     * The maximum number of cached names.
+     */
+    private static final int MAX_CACHED_NAMES = 512;
+
+    /**
+     * The thread pool keep alive time.
+     */
+    private static final long THREAD_POOL_KEEP_ALIVE_TIME = 10000L;
+
+    /**
+     * The default time to live of successful lookups, used when the
+     * security property is not set, as in {@code InetAddressCachePolicy}.
+     */
+    private static final int DEFAULT_TTL = 30;
+
+    /**
+     * The default time to live of failed lookups.
+     */
+    private static final int DEFAULT_NEGATIVE_TTL = 10;
+
+    private static final AtomicInteger threadIndex = new AtomicInteger(1);
+    private static final ThreadPoolExecutor threadPool;
+    static {
+        threadPool = new ThreadPoolExecutor(
+                THREAD_POOL_SIZE,
+                THREAD_POOL_SIZE,
+                THREAD_POOL_KEEP_ALIVE_TIME,
+                TimeUnit.MILLISECONDS,
+                new LinkedBlockingQueue<Runnable>(MAX_QUEUED_LOOKUPS),
+                r -> {
+                    Thread t = new Thread(r, "DNS-Resolver-" + threadIndex.getAndIncrement());
+                    t.setDaemon(true);
+                    return t;
+                });
+        threadPool.allowCoreThreadTimeOut(true);
+    }
+
+    private static final Map<String, CompletableFuture<InetAddress[]>> lookups =
+            new ConcurrentHashMap<>();
+    private static final Map<String, CacheEntry> cache = new ConcurrentHashMap<>();
+
+    private static volatile Resolver resolver = InetAddress::getAllByName;
+    private static volatile long ttlNanos = ttl("networkaddress.cache.ttl", DEFAULT_TTL);
+    private static volatile long negativeTtlNanos =
+            ttl("networkaddress.cache.negative.ttl", DEFAULT_NEGATIVE_TTL);
+
+    private static final class CacheEntry {
+        // null if the name could not be resolved
+        private final InetAddress[] addresses;
+        private final long expiration;
+
+        private CacheEntry(InetAddress[] addresses, long expiration) {
+            this.addresses = addresses;
+            this.expiration = expiration;
+        }
+    }
+
+    /**
+     * Non-invocable constructor.
+     */
+    private DNSResolver() {
+        throw new AssertionError();
+    }
+
+    /**
+     * Returns the time to live in nanoseconds configured by the given
+     * security property, or {@code Long.MAX_VALUE} for "cache forever".
+     */
+    @SuppressWarnings("removal")
+    private static long ttl(String property, int defaultValue) {
+        String value = AccessController.doPrivileged(
+                (PrivilegedAction<String>) () -> Security.getProperty(property));
+        int seconds = defaultValue;
+        if (value != null) {
+            try {
+                seconds = Integer.parseInt(value.trim());
+            } catch (NumberFormatException ex) {
+                logger.finest("Invalid {0}: [{1}]", property, value);
+            }
+        }
+        return seconds < 0 ? Long.MAX_VALUE : TimeUnit.SECONDS.toNanos(seconds);
+    }
+
+    /**
+     * Replaces the resolver and the cache policy and clears the cache.
+     * Used by tests.
+     */
+    static void setResolver(Resolver newResolver, long ttl, long negativeTtl, TimeUnit unit) {
+        resolver = newResolver;
+        ttlNanos = unit.toNanos(ttl);
+        negativeTtlNanos = unit.toNanos(negativeTtl);
+        cache.clear();
+    }
+
+    /**
+     * Restores the default resolver and cache policy and clears the cache.
+     * Used by tests.
+     */
+    static void resetResolver() {
+        setResolver(InetAddress::getAllByName,
+                ttl("networkaddress.cache.ttl", DEFAULT_TTL),
+                ttl("networkaddress.cache.negative.ttl", DEFAULT_NEGATIVE_TTL),
+                TimeUnit.NANOSECONDS);
+    }
+
+    /**
+     * Returns the addresses of the given host, from the cache if a live
+     * entry exists and from a lookup on the thread pool otherwise.
+     * Concurrent requests for the same host share a single lookup.
+     */
+    static CompletableFuture<InetAddress[]> resolve(String host) {
+        CacheEntry entry = cache.get(host);
+        if (entry != null) {
+            if (System.nanoTime() - entry.expiration < 0) {
+                return entry.addresses != null
+                        ? CompletableFuture.completedFuture(entry.addresses)
+                        : CompletableFuture.failedFuture(new UnknownHostException(host));
+            }
+            cache.remove(host, entry);
+        }
+        CompletableFuture<InetAddress[]> future = new CompletableFuture<>();
+        CompletableFuture<InetAddress[]> pending = lookups.putIfAbsent(host, future);
+        if (pending != null) {
+            return pending;
+        }
+        Resolver r = resolver;
+        try {
+            threadPool.execute(() -> lookup(r, host, future));
+        } catch (RejectedExecutionException ex) {
+            // Too many lookups in flight, the caller can try again later
+            lookups.remove(host, future);
+            future.completeExceptionally(ex);
+        }
+        return future;
+    }
+
+    @SuppressWarnings("removal")
+    private static void lookup(Resolver r, String host,
+                               CompletableFuture<InetAddress[]> future)
+    {
+        InetAddress[] addresses = null;
+        Throwable error = null;
+        try {
+            addresses = AccessController.doPrivileged(
+                    (PrivilegedExceptionAction<InetAddress[]>) () -> r.resolve(host));
+        } catch (PrivilegedActionException ex) {
+            if (!(ex.getException() instanceof UnknownHostException)) {
+                error = ex.getException();
+            }
+        } catch (RuntimeException ex) {
+            error = ex;
+        }
+
+        // Failures other than unknown hosts are not cached
+        long ttl = addresses != null ? ttlNanos
+                : error == null ? negativeTtlNanos : 0;
+        if (ttl > 0) {
+            long now = System.nanoTime();
+            if (cache.size() >= MAX_CACHED_NAMES) {
+                cache.values().removeIf(e -> now - e.expiration >= 0);
+            }
+            if (cache.size() < MAX_CACHED_NAMES) {
+                long expiration = ttl == Long.MAX_VALUE
+                        ? now + (Long.MAX_VALUE >> 1) : now + ttl;
+                cache.put(host, new CacheEntry(addresses, expiration));
+            }
+        }
+        lookups.remove(host, future);
+
+        if (logger.isLoggable(Level.FINEST)) {
+            logger.finest("host: [{0}], resolved: [{1}]", host, addresses != null);
+        }
+        if (addresses != null) {
+            future.complete(addresses);
+        } else {
+            future.completeExceptionally(error != null
+                    ? error : new UnknownHostException(host));
+        }
+    }
+
+    /**
+     * Resolves the given host to warm the caches, and notifies the
+     * native code when done.
+     */
+    private static void fwkPrefetch(String host) {
+        resolve(host).whenComplete((addresses, error) -> twkDidPrefetch());
+    }
+
+    /**
+     * Resolves the given host and passes the raw addresses to the native
+     * code on the event thread, or {@code null} if the host could not be
+     * resolved.
+     */
+    private static void fwkResolve(String host, long identifier) {
+        resolve(host).whenComplete((addresses, error) -> {
+            final byte[][] result;
+            if (addresses != null) {
+                result = new byte[addresses.length][];
+                for (int i = 0; i < addresses.length; i++) {
+                    result[i] = addresses[i].getAddress();
+                }
+            } else {
+                result = null;
+            }
+            Invoker.getInvoker().postOnEventThread(() -> twkDidResolve(identifier, result));
+        });
+    }
+
+    /**
+     * Returns whether HTTP requests go through a proxy, in which case
+     * prefetching is pointless because the proxy resolves names itself.
+     */
+    @SuppressWarnings("removal")
+    private static boolean fwkIsUsingProxy() {
+        return AccessController.doPrivileged((PrivilegedAction<Boolean>) () -> {
+            ProxySelector selector = ProxySelector.getDefault();
+            if (selector == null) {
+                return false;
+            }
+            List<Proxy> proxies = selector.select(URI.create("http://www.example.com/"));
+            for (Proxy proxy : proxies) {
+                if (proxy.type() != Proxy.Type.DIRECT) {
+                    return true;
+                }
+            }
+            return false;
+        });
+    }
+
+    private static native void twkDidPrefetch();
+    private static native void twkDidResolve(long identifier, byte[][] addresses);
+}
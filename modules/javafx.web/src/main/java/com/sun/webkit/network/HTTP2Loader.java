@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -98,18 +98,6 @@ final class HTTP2Loader extends URLLoaderBase {
                 .connectTimeout(Duration.ofSeconds(30)) // FIXME: Add a property to control the timeout
                 .cookieHandler(CookieHandler.getDefault())
                 .build());
-    // Singleton instance of direct ByteBuffer to transfer downloaded bytes from
-    // Java to native
-    private static final int DEFAULT_BUFSIZE = 40 * 1024;
-    private final static ByteBuffer BUFFER;
-    static {
-       @SuppressWarnings("removal")
-       int bufSize  = AccessController.doPrivileged(
-                        (PrivilegedAction<Integer>) () ->
-                            Integer.valueOf(System.getProperty("jdk.httpclient.bufsize", Integer.toString(DEFAULT_BUFSIZE))));
-       BUFFER = ByteBuffer.allocateDirect(bufSize);
-    }
-
     /**
      * Creates a new {@code HTTP2Loader}.
      */
@@ -510,48 +498,44 @@ final class HTTP2Loader extends URLLoaderBase {
         });
     }
 
-    private ByteBuffer getDirectBuffer(int size) {
-        ByteBuffer dbb = BUFFER;
-        // Though the chance of reaching here is rare, handle the
-        // case by allocating a tmp direct buffer.
-        if (size > dbb.capacity()) {
-            dbb = ByteBuffer.allocateDirect(size);
-        }
-        return dbb.clear();
-    }
-
-    private ByteBuffer copyToDirectBuffer(final ByteBuffer bb) {
-        return getDirectBuffer(bb.limit()).put(bb).flip();
+    // The segments are filled on the thread that received the data and
+    // handed over to the native code without any further copy.
+    private void didReceiveData(final ByteBuffer segment) {
+        Invoker.getInvoker().invokeOnEventThread(() -> {
+            if (canceled) {
+                twkFreeSegment(segment);
+            } else {
+                notifyDidReceiveData(segment);
+            }
+        });
     }
 
     // another variant to use from createZIPEncodedBodySubscriber
     private void didReceiveData(final byte[] bytes, int size) {
-        callBackIfNotCanceled(() -> {
-            notifyDidReceiveData(getDirectBuffer(size).put(bytes, 0, size).flip());
-        });
+        didReceiveData(twkAllocateSegment(size).put(bytes, 0, size).flip());
     }
 
     private void didReceiveData(final List<ByteBuffer> bytes) {
-        callBackIfNotCanceled(() -> bytes.stream()
-                                          .map(this::copyToDirectBuffer)
-                                          .forEach(this::notifyDidReceiveData)
-        );
+        final int size = bytes.stream().mapToInt(ByteBuffer::remaining).sum();
+        if (size > 0) {
+            final ByteBuffer segment = twkAllocateSegment(size);
+            bytes.forEach(segment::put);
+            didReceiveData(segment.flip());
+        }
     }
 
-    private void notifyDidReceiveData(ByteBuffer byteBuffer) {
+    private void notifyDidReceiveData(ByteBuffer segment) {
         Invoker.getInvoker().checkEventThread();
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
-                    "byteBuffer: [%s], "
-                    + "position: [%s], "
-                    + "remaining: [%s], "
+                    "segment: [%s], "
+                    + "length: [%s], "
                     + "data: [0x%016X]",
-                    byteBuffer,
-                    byteBuffer.position(),
-                    byteBuffer.remaining(),
+                    segment,
+                    segment.limit(),
                     data));
         }
-        twkDidReceiveData(byteBuffer, byteBuffer.position(), byteBuffer.remaining(), data);
+        twkDidReceiveSegment(segment, segment.limit(), data);
     }
 
     private void didFinishLoading() {
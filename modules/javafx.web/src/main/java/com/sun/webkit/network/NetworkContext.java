@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,7 @@ import java.net.MalformedURLException;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.Arrays;
+import java.util.Objects;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
@@ -42,7 +43,7 @@ import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.webkit.WebPage;
 import java.security.Permission;
 
-final class NetworkContext {
+public final class NetworkContext {
 
     private static final PlatformLogger logger =
             PlatformLogger.getLogger(NetworkContext.class.getName());
@@ -68,6 +69,11 @@ final class NetworkContext {
      */
     private static final int DEFAULT_HTTP2_MAX_CONNECTIONS = 20;
 
+    /**
+     * The default maximum size of the native HTTP disk cache
+     */
+    private static final long DEFAULT_HTTP_CACHE_CAPACITY = 256L * 1024 * 1024;
+
     /**
      * The buffer size for the shared pool of byte buffers.
      */
@@ -228,6 +234,39 @@ final class NetworkContext {
         return propValue >= 0 ? propValue : DEFAULT_HTTP_MAX_CONNECTIONS;
     }
 
+    /**
+     * The HTTP disk cache configuration last passed to native code.
+     * Accessed on the event thread only.
+     */
+    private static String httpCacheDirectory;
+    private static long httpCacheCapacity;
+
+    /**
+     * Passes the configuration of the native HTTP disk cache to native
+     * code if the system properties have changed since the last call.
+     * Called on the event thread before a page starts a load, so that
+     * native code does not need to call back on every request. The cache
+     * is disabled unless the directory property is set.
+     */
+    public static void updateHTTPCacheConfiguration() {
+        @SuppressWarnings("removal")
+        String directory = AccessController.doPrivileged(
+                (PrivilegedAction<String>) () -> System.getProperty("com.sun.webkit.httpCache.directory"));
+        @SuppressWarnings("removal")
+        long propValue = AccessController.doPrivileged(
+                (PrivilegedAction<Long>) () -> Long.getLong("com.sun.webkit.httpCache.capacity", -1L));
+        long capacity = propValue > 0 ? propValue : DEFAULT_HTTP_CACHE_CAPACITY;
+
+        if (Objects.equals(directory, httpCacheDirectory) && capacity == httpCacheCapacity) {
+            return;
+        }
+        httpCacheDirectory = directory;
+        httpCacheCapacity = capacity;
+        twkSetHTTPCacheConfiguration(directory, capacity);
+    }
+
+    private static native void twkSetHTTPCacheConfiguration(String directory, long capacity);
+
     /**
      * Thread factory for URL loader threads.
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,9 +43,11 @@ import java.net.SocketException;
 import java.net.URI;
 import java.net.URISyntaxException;
 import java.net.UnknownHostException;
+import java.nio.ByteBuffer;
 import java.security.AccessController;
 import java.security.PrivilegedAction;
 import java.util.List;
+import java.util.concurrent.ConcurrentLinkedQueue;
 import java.util.concurrent.SynchronousQueue;
 import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
@@ -67,6 +69,14 @@ final class SocketStreamHandle {
             new SynchronousQueue<Runnable>(),
             new CustomThreadFactory());
 
+    // Received data is accumulated in direct buffers of this size (or
+    // larger, for bursts that do not fit), which are recycled through
+    // a small pool shared by all handles.
+    private static final int BUFFER_SIZE = 64 * 1024;
+    private static final int MAX_POOLED_BUFFERS = 16;
+    private static final ConcurrentLinkedQueue<ByteBuffer> bufferPool =
+            new ConcurrentLinkedQueue<>();
+
     private enum State {ACTIVE, CLOSE_REQUESTED, DISPOSED}
 
     private final String host;
@@ -77,6 +87,14 @@ final class SocketStreamHandle {
     private volatile Socket socket;
     private volatile State state = State.ACTIVE;
     private volatile boolean connected;
+    // Data read from the socket and not yet passed to the native code,
+    // guarded by receiveLock. Only one delivery is posted to the event
+    // thread at a time, which takes everything received until it runs.
+    private final Object receiveLock = new Object();
+    private ByteBuffer received;
+    private boolean deliveryPending;
+    // Only accessed from the event thread
+    private byte[] sendBuffer;
 
     private SocketStreamHandle(String host, int port, boolean ssl,
                                WebPage webPage, long data)
@@ -130,8 +148,8 @@ final class SocketStreamHandle {
             logger.finest("{0} connected", this);
             didOpen();
             InputStream is = socket.getInputStream();
+            byte[] buffer = new byte[8192];
             while (true) {
-                byte[] buffer = new byte[8192];
                 int n = is.read(buffer);
                 if(n > 0) {
                     if (logger.isLoggable(Level.FINEST)) {
@@ -286,15 +304,26 @@ final class SocketStreamHandle {
         }
     }
 
-    private int fwkSend(byte[] buffer) {
+    /**
+     * Sends the data in {@code buffer}, a direct buffer that wraps native
+     * memory and is only valid for the duration of the call.
+     */
+    private int fwkSend(ByteBuffer buffer) {
+        int len = buffer.remaining();
+        // Socket streams only take arrays, so the data is copied once into
+        // a buffer that is reused across sends.
+        if (sendBuffer == null || sendBuffer.length < len) {
+            sendBuffer = new byte[Math.max(len, 8192)];
+        }
+        buffer.get(sendBuffer, 0, len);
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(format("%s sending len: [%d], data:%s",
-                    this, buffer.length, dump(buffer, buffer.length)));
+                    this, len, dump(sendBuffer, len)));
         }
         if (connected) {
             try {
-                socket.getOutputStream().write(buffer);
-                return buffer.length;
+                socket.getOutputStream().write(sendBuffer, 0, len);
+                return len;
             } catch (IOException ex) {
                 logger.finest(format("%s exception", this), ex);
                 didFail(0, "I/O error");
@@ -332,12 +361,57 @@ final class SocketStreamHandle {
         });
     }
 
-    private void didReceiveData(final byte[] buffer, final int len) {
-        Invoker.getInvoker().postOnEventThread(() -> {
-            if (state == State.ACTIVE) {
-                notifyDidReceiveData(buffer, len);
+    private void didReceiveData(byte[] buffer, int len) {
+        synchronized (receiveLock) {
+            if (received == null) {
+                received = acquireBuffer(len);
+            } else if (received.remaining() < len) {
+                // Grow geometrically so that data arriving faster than it is
+                // delivered is not copied over and over again
+                ByteBuffer larger = acquireBuffer(Math.max(
+                        received.capacity() * 2, received.position() + len));
+                received.flip();
+                larger.put(received);
+                releaseBuffer(received);
+                received = larger;
             }
-        });
+            received.put(buffer, 0, len);
+            if (deliveryPending) {
+                return;
+            }
+            deliveryPending = true;
+        }
+        Invoker.getInvoker().postOnEventThread(this::deliverReceivedData);
+    }
+
+    private void deliverReceivedData() {
+        ByteBuffer buffer;
+        synchronized (receiveLock) {
+            buffer = received;
+            received = null;
+            deliveryPending = false;
+        }
+        if (state == State.ACTIVE) {
+            notifyDidReceiveData(buffer, buffer.position());
+        }
+        releaseBuffer(buffer);
+    }
+
+    private static ByteBuffer acquireBuffer(int minCapacity) {
+        if (minCapacity > BUFFER_SIZE) {
+            return ByteBuffer.allocateDirect(minCapacity);
+        }
+        ByteBuffer buffer = bufferPool.poll();
+        return buffer != null ? buffer : ByteBuffer.allocateDirect(BUFFER_SIZE);
+    }
+
+    private static void releaseBuffer(ByteBuffer buffer) {
+        // The pool size is only approximate, which is fine for a cache
+        if (buffer.capacity() == BUFFER_SIZE
+                && bufferPool.size() < MAX_POOLED_BUFFERS) {
+            buffer.clear();
+            bufferPool.offer(buffer);
+        }
     }
 
     private void didFail(final int errorCode, final String errorDescription) {
@@ -361,11 +435,8 @@ final class SocketStreamHandle {
         twkDidOpen(data);
     }
 
-    private void notifyDidReceiveData(byte[] buffer, int len) {
-        if (logger.isLoggable(Level.FINEST)) {
-            logger.finest(format("%s, len: [%d], data:%s",
-                    this, len, dump(buffer, len)));
-        }
+    private void notifyDidReceiveData(ByteBuffer buffer, int len) {
+        logger.finest("{0}, len: [{1}]", this, len);
         twkDidReceiveData(buffer, len, data);
     }
 
@@ -384,7 +455,7 @@ final class SocketStreamHandle {
     }
 
     private static native void twkDidOpen(long data);
-    private static native void twkDidReceiveData(byte[] buffer, int len,
+    private static native void twkDidReceiveData(ByteBuffer buffer, int len,
                                                  long data);
     private static native void twkDidFail(int errorCode,
                                           String errorDescription, long data);
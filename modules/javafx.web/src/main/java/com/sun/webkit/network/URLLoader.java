@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -734,31 +734,25 @@ final class URLLoader extends URLLoaderBase implements Runnable {
     {
         callBack(() -> {
             if (!canceled) {
-                notifyDidReceiveData(
-                        byteBuffer,
-                        byteBuffer.position(),
-                        byteBuffer.remaining());
+                notifyDidReceiveData(byteBuffer, byteBuffer.limit());
+                allocator.detach(byteBuffer);
+            } else {
+                allocator.release(byteBuffer);
             }
-            allocator.release(byteBuffer);
         });
     }
 
-    private void notifyDidReceiveData(ByteBuffer byteBuffer,
-                                      int position,
-                                      int remaining)
-    {
+    private void notifyDidReceiveData(ByteBuffer byteBuffer, int length) {
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
                     "byteBuffer: [%s], "
-                    + "position: [%s], "
-                    + "remaining: [%s], "
+                    + "length: [%s], "
                     + "data: [0x%016X]",
                     byteBuffer,
-                    position,
-                    remaining,
+                    length,
                     data));
         }
-        twkDidReceiveData(byteBuffer, position, remaining, data);
+        twkDidReceiveSegment(byteBuffer, length, data);
     }
 
     private void didFinishLoading() {
@@ -56,10 +56,22 @@ abstract class URLLoaderBase {
                                                      String url,
                                                      long data);
 
-    protected static native void twkDidReceiveData(ByteBuffer byteBuffer,
-                                                 int position,
-                                                 int remaining,
-                                                 long data);
+    /**
+     * Allocates a direct byte buffer backed by native memory. The buffer
+     * is either handed over with {@link #twkDidReceiveSegment} or freed
+     * with {@link #twkFreeSegment}; it must not be used after that.
+     */
+    protected static native ByteBuffer twkAllocateSegment(int capacity);
+
+    protected static native void twkFreeSegment(ByteBuffer segment);
+
+    /**
+     * Delivers the first {@code length} bytes of a segment. The native
+     * code takes over the memory of the segment without copying it.
+     */
+    protected static native void twkDidReceiveSegment(ByteBuffer segment,
+                                                    int length,
+                                                    long data);
 
     protected static native void twkDidFinishLoading(long data);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,7 +27,7 @@ package com.sun.webkit.perf;
 
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.webkit.graphics.WCFont;
-import com.sun.webkit.graphics.WCTextRun;
+import java.nio.ByteBuffer;
 
 public final class WCFontPerfLogger extends WCFont {
     private static final PlatformLogger log =
@@ -67,9 +67,9 @@ public final class WCFontPerfLogger extends WCFont {
     }
 
     @Override
-    public WCTextRun[] getTextRuns(String str) {
+    public ByteBuffer getTextRuns(String str) {
         logger.resumeCount("GETTEXTRUNS");
-        final WCTextRun runs[] = fnt.getTextRuns(str);
+        final ByteBuffer runs = fnt.getTextRuns(str);
         logger.suspendCount("GETTEXTRUNS");
         return runs;
     }
@@ -99,11 +99,17 @@ public final class WCFontPerfLogger extends WCFont {
     }
 
     @Override
-    public float[] getGlyphBoundingBox(int glyph) {
+    public void getGlyphWidths(int firstGlyph, int count, ByteBuffer widths) {
+        logger.resumeCount("GETGLYPHWIDTHS");
+        fnt.getGlyphWidths(firstGlyph, count, widths);
+        logger.suspendCount("GETGLYPHWIDTHS");
+    }
+
+    @Override
+    public void getGlyphBoundingBox(int glyph, ByteBuffer bounds) {
         logger.resumeCount("GETGLYPHBOUNDINGBOX");
-        float[] res = fnt.getGlyphBoundingBox(glyph);
+        fnt.getGlyphBoundingBox(glyph, bounds);
         logger.suspendCount("GETGLYPHBOUNDINGBOX");
-        return res;
     }
 
     @Override
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -1025,10 +1025,16 @@ final public class WebEngine {
             try {
                 userDataDir = DirectoryLock.canonicalize(userDataDir);
                 File localStorageDir = new File(userDataDir, "localstorage");
-                File[] dirs = new File[] {
+                File indexedDBDir = new File(userDataDir, "indexeddb");
+                File bytecodeCacheDir = WebPage.isBytecodeCacheEnabled()
+                        ? new File(userDataDir, "bytecodecache") : null;
+                List<File> dirs = new ArrayList<>(List.of(
                     userDataDir,
                     localStorageDir,
-                };
+                    indexedDBDir));
+                if (bytecodeCacheDir != null) {
+                    dirs.add(bytecodeCacheDir);
+                }
                 for (File dir : dirs) {
                     createDirectories(dir);
                     // Additional security check to make sure the caller
@@ -1042,6 +1048,10 @@ final public class WebEngine {
 
                 page.setLocalStorageDatabasePath(localStorageDir.getPath());
                 page.setLocalStorageEnabled(true);
+                page.setIndexedDatabaseDirectory(indexedDBDir.getPath());
+                if (bytecodeCacheDir != null) {
+                    WebPage.setBytecodeCacheDirectory(bytecodeCacheDir.getPath());
+                }
 
                 logger.fine("User data directory [{0}] has "
                         + "been applied successfully", displayString);
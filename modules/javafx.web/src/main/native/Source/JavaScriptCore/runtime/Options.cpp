@@ -753,6 +753,12 @@ void Options::notifyOptionsChanged()
     }
 #endif
 
+#if PLATFORM(JAVA)
+    // The JVM owns SIGSEGV and SIGBUS, so wasm memory accesses are bounds
+    // checked explicitly instead of relying on faults.
+    Options::useWasmFaultSignalHandler() = false;
+#endif
+
     if (!Options::useWasmFaultSignalHandler())
         Options::useWebAssemblyFastMemory() = false;
 
@@ -64,8 +64,16 @@ namespace WTF {
 namespace FileSystemImpl {
 // PlatformFileHandle
 #if PLATFORM(JAVA)
-typedef JGObject PlatformFileHandle;
-const PlatformFileHandle invalidPlatformFileHandle { nullptr };
+// Files are accessed through a native descriptor when possible, and through
+// a java.io.RandomAccessFile when a SecurityManager restricts native access.
+struct PlatformFileHandle {
+    int fd { -1 };
+    JGObject file;
+
+    bool operator==(const PlatformFileHandle& other) const { return fd == other.fd && file == other.file; }
+    bool operator!=(const PlatformFileHandle& other) const { return !(*this == other); }
+};
+const PlatformFileHandle invalidPlatformFileHandle { };
 
 #elif OS(WINDOWS)
 typedef HANDLE PlatformFileHandle;
@@ -99,6 +99,9 @@ public:
 #endif
 #if PLATFORM(JAVA)
     WTF_EXPORT_PRIVATE void dispatchFunctionsFromMainThread();
+#if USE(GENERIC_EVENT_LOOP)
+    WTF_EXPORT_PRIVATE void fireTimersFromMainThread();
+#endif
 #endif
 
     WTF_EXPORT_PRIVATE static void run();
@@ -258,6 +261,9 @@ private:
     void scheduleWithLock(TimerBase::ScheduledTask&) WTF_REQUIRES_LOCK(m_loopLock);
     void unscheduleWithLock(TimerBase::ScheduledTask&) WTF_REQUIRES_LOCK(m_loopLock);
     void wakeUpWithLock() WTF_REQUIRES_LOCK(m_loopLock);
+#if PLATFORM(JAVA)
+    void scheduleMainThreadTimersWithLock() WTF_REQUIRES_LOCK(m_loopLock);
+#endif
 
     enum class RunMode {
         Iterate,
@@ -280,6 +286,9 @@ private:
     Vector<Status*> m_mainLoops;
     bool m_shutdown { false };
     bool m_pendingTasks { false };
+#if PLATFORM(JAVA)
+    MonotonicTime m_mainThreadTimersFireTime { MonotonicTime::infinity() };
+#endif
 #endif
 
 #if USE(GENERIC_EVENT_LOOP) || USE(WINDOWS_EVENT_LOOP)
@@ -28,6 +28,9 @@
 #include <wtf/RunLoop.h>
 
 #include <wtf/DataLog.h>
+#if PLATFORM(JAVA)
+#include <wtf/MainThread.h>
+#endif
 #include <wtf/NeverDestroyed.h>
 #include <wtf/ProcessID.h>
 
@@ -295,6 +298,56 @@ void RunLoop::unscheduleWithLock(TimerBase::ScheduledTask& task)
     }
 }
 
+#if PLATFORM(JAVA)
+// The main RunLoop is never run on the Java port, the java event loop
+// is. Ask it to call fireTimersFromMainThread() once the earliest timer
+// is due.
+void RunLoop::scheduleMainThreadTimersWithLock()
+{
+    if (this != &RunLoop::main() || m_schedules.isEmpty())
+        return;
+
+    MonotonicTime fireTime = m_schedules.first()->scheduledTimePoint();
+    if (fireTime >= m_mainThreadTimersFireTime)
+        return;
+
+    m_mainThreadTimersFireTime = fireTime;
+    scheduleTimersOnMainThread(std::max<Seconds>(fireTime - MonotonicTime::now(), 0_s));
+}
+
+void RunLoop::fireTimersFromMainThread()
+{
+    ASSERT(this == &RunLoop::main());
+
+    Deque<Ref<TimerBase::ScheduledTask>> firedTimers;
+    {
+        Locker locker { m_loopLock };
+        m_mainThreadTimersFireTime = MonotonicTime::infinity();
+
+        MonotonicTime now = MonotonicTime::now();
+        while (!m_schedules.isEmpty()) {
+            auto task = m_schedules.first();
+            if (task->scheduledTimePoint() > now)
+                break;
+            unscheduleWithLock(*task);
+            firedTimers.append(Ref(*task));
+        }
+    }
+
+    while (!firedTimers.isEmpty()) {
+        auto task = firedTimers.takeFirst();
+        task->fired();
+
+        Locker locker { m_loopLock };
+        if (task->isActive() && !task->isScheduled())
+            scheduleWithLock(task.get());
+    }
+
+    Locker locker { m_loopLock };
+    scheduleMainThreadTimersWithLock();
+}
+#endif
+
 // Since RunLoop does not own the registered TimerBase,
 // TimerBase and its owner should manage these lifetime.
 RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
@@ -316,6 +369,9 @@ void RunLoop::TimerBase::start(Seconds interval, bool repeating)
     m_scheduledTask->activate(interval, repeating);
     m_runLoop->scheduleWithLock(m_scheduledTask.get());
     m_runLoop->wakeUpWithLock();
+#if PLATFORM(JAVA)
+    m_runLoop->scheduleMainThreadTimersWithLock();
+#endif
 }
 
 void RunLoop::TimerBase::stopWithLock()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,19 +26,74 @@
 #include "config.h"
 #include "FileSystem.h"
 #include "FileMetadata.h"
+#include <wtf/CheckedArithmetic.h>
 #include <wtf/java/JavaEnv.h>
 #include <wtf/text/CString.h>
+#include <wtf/text/StringConcatenate.h>
+
+#if OS(UNIX)
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace WTF {
 
 namespace FileSystemImpl {
 
+#if OS(UNIX)
+// Native file access is used unless a SecurityManager is installed, in which
+// case every access has to go through Java so that it is checked against the
+// policy. The decision is made once, the first time a file is touched.
+static bool useNativeFileAccess()
+{
+    static const bool useNative = [] {
+        AttachThreadAsDaemonToJavaEnv autoAttach;
+        JNIEnv* env = autoAttach.env();
+        if (!env)
+            return false;
+
+        static jmethodID mid = env->GetStaticMethodID(
+                comSunWebkitFileSystem,
+                "fwkUseNativeFileAccess",
+                "()Z");
+        ASSERT(mid);
+
+        jboolean result = env->CallStaticBooleanMethod(
+                comSunWebkitFileSystem,
+                mid);
+        if (WTF::CheckAndClearException(env))
+            return false;
+        return jbool_to_bool(result);
+    }();
+    return useNative;
+}
+
+static std::optional<FileType> toFileType(const struct stat& fileInfo)
+{
+    if (S_ISDIR(fileInfo.st_mode))
+        return FileType::Directory;
+    if (S_ISLNK(fileInfo.st_mode))
+        return FileType::SymbolicLink;
+    return FileType::Regular;
+}
+#endif
 
 // -----------------------------------------------------------------------
-//  Below methods use Java calls to implement the intended functionality.
+//  Below methods use native calls on POSIX systems and fall back to Java
+//  calls when native file access is not allowed.
 // -----------------------------------------------------------------------
 bool fileExists(const String& path)
 {
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        return !fsRep.isNull() && !access(fsRep.data(), F_OK);
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -59,6 +114,16 @@ bool fileExists(const String& path)
 
 bool getFileSize(const String& path, long long& result)
 {
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        struct stat fileInfo;
+        if (fsRep.isNull() || stat(fsRep.data(), &fileInfo) || S_ISDIR(fileInfo.st_mode))
+            return false;
+        result = fileInfo.st_size;
+        return true;
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -84,12 +149,30 @@ bool getFileSize(const String& path, long long& result)
 std::optional<uint64_t> fileSize(const String& path)
 {
     long long size = 0;
-    getFileSize(path, size);
+    if (!getFileSize(path, size))
+        return std::nullopt;
     return size;
 }
 
 std::optional<FileMetadata> fileMetadata(const String& path)
 {
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        struct stat fileInfo;
+        if (fsRep.isNull() || lstat(fsRep.data(), &fileInfo))
+            return std::nullopt;
+
+        FileMetadata metadata {};
+        metadata.modificationTime = WallTime::fromRawSeconds(fileInfo.st_mtime);
+        metadata.length = fileInfo.st_size;
+        metadata.isHidden = pathFileName(path).startsWith('.');
+        metadata.type = S_ISDIR(fileInfo.st_mode) ? FileMetadata::Type::Directory
+            : S_ISLNK(fileInfo.st_mode) ? FileMetadata::Type::SymbolicLink
+            : FileMetadata::Type::File;
+        return metadata;
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -146,6 +229,10 @@ String pathByAppendingComponents(StringView path, const Vector<StringView>& comp
 
 String pathByAppendingComponent(const String& path, const String& component)
 {
+#if OS(UNIX)
+    if (useNativeFileAccess())
+        return pathByAppendingComponent(StringView(path), StringView(component));
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -166,6 +253,13 @@ String pathByAppendingComponent(const String& path, const String& component)
 
 String pathByAppendingComponent(StringView path, StringView component)
 {
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        if (path.endsWith('/'))
+            return makeString(path, component);
+        return makeString(path, '/', component);
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -186,6 +280,31 @@ String pathByAppendingComponent(StringView path, StringView component)
 
 bool makeAllDirectories(const String& path)
 {
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fullPath = fileSystemRepresentation(path);
+        if (fullPath.isNull() || !fullPath.length())
+            return false;
+        if (!access(fullPath.data(), F_OK))
+            return true;
+
+        char* p = fullPath.mutableData() + 1;
+        int length = fullPath.length();
+        if (p[length - 2] == '/')
+            p[length - 2] = '\0';
+        for (; *p; ++p) {
+            if (*p == '/') {
+                *p = '\0';
+                if (access(fullPath.data(), F_OK) && mkdir(fullPath.data(), S_IRWXU | S_IRWXG | S_IRWXO))
+                    return false;
+                *p = '/';
+            }
+        }
+        if (access(fullPath.data(), F_OK) && mkdir(fullPath.data(), S_IRWXU | S_IRWXG | S_IRWXO))
+            return false;
+        return true;
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -206,46 +325,102 @@ bool makeAllDirectories(const String& path)
 
 CString fileSystemRepresentation(const String& s)
 {
+#if OS(UNIX)
+    return s.utf8();
+#else
     return CString(s.latin1().data());
+#endif
 }
 
-PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission, bool)
+PlatformFileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission permission, bool failIfFileExists)
 {
-    if (mode != FileOpenMode::Read) {
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        if (fsRep.isNull())
+            return invalidPlatformFileHandle;
+
+        int platformFlag = O_CLOEXEC;
+        switch (mode) {
+        case FileOpenMode::Read:
+            platformFlag |= O_RDONLY;
+            break;
+        case FileOpenMode::Truncate:
+            platformFlag |= (O_WRONLY | O_CREAT | O_TRUNC);
+            break;
+        case FileOpenMode::ReadWrite:
+            platformFlag |= (O_RDWR | O_CREAT);
+            break;
+#if OS(DARWIN)
+        case FileOpenMode::EventsOnly:
+            platformFlag |= O_EVTONLY;
+            break;
+#endif
+        }
+        if (failIfFileExists)
+            platformFlag |= (O_CREAT | O_EXCL);
+
+        int permissionFlag = 0;
+        if (permission == FileAccessPermission::User)
+            permissionFlag |= (S_IRUSR | S_IWUSR);
+        else if (permission == FileAccessPermission::All)
+            permissionFlag |= (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+
+        int fd = open(fsRep.data(), platformFlag, permissionFlag);
+        if (fd < 0)
+            return invalidPlatformFileHandle;
+        return PlatformFileHandle { fd, nullptr };
+    }
+#else
+    UNUSED_PARAM(permission);
+#endif
+    if (failIfFileExists && fileExists(path)) {
         return invalidPlatformFileHandle;
     }
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mid = env->GetStaticMethodID(
             comSunWebkitFileSystem,
             "fwkOpenFile",
-            "(Ljava/lang/String;Ljava/lang/String;)Ljava/io/RandomAccessFile;");
+            "(Ljava/lang/String;Ljava/lang/String;Z)Ljava/io/RandomAccessFile;");
     ASSERT(mid);
 
-    PlatformFileHandle result = env->CallStaticObjectMethod(
+    JLString javaMode(env->NewStringUTF(mode == FileOpenMode::Read ? "r" : "rw"));
+    JLObject result(env->CallStaticObjectMethod(
             comSunWebkitFileSystem,
             mid,
-            (jstring)path.toJavaString(env), (jstring)(env->NewStringUTF("r")));
-
-    WTF::CheckAndClearException(env);
-    return result ? result : invalidPlatformFileHandle;
+            (jstring)path.toJavaString(env),
+            (jstring)javaMode,
+            bool_to_jbool(mode == FileOpenMode::Truncate)));
+    if (WTF::CheckAndClearException(env) || !result) {
+        return invalidPlatformFileHandle;
+    }
+    return PlatformFileHandle { -1, JGObject(result) };
 }
 
 void closeFile(PlatformFileHandle& handle)
 {
-    if (isHandleValid(handle)) {
-        JNIEnv* env = WTF::GetJavaEnv();
-        static jmethodID mid = env->GetStaticMethodID(
-                comSunWebkitFileSystem,
-                "fwkCloseFile",
-                "(Ljava/io/RandomAccessFile;)V");
-        ASSERT(mid);
-
-        env->CallStaticVoidMethod(
-                comSunWebkitFileSystem,
-                mid, (jobject)handle);
-        WTF::CheckAndClearException(env);
+    if (!isHandleValid(handle)) {
+        return;
+    }
+#if OS(UNIX)
+    if (handle.fd >= 0) {
+        close(handle.fd);
         handle = invalidPlatformFileHandle;
+        return;
     }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkCloseFile",
+            "(Ljava/io/RandomAccessFile;)V");
+    ASSERT(mid);
+
+    env->CallStaticVoidMethod(
+            comSunWebkitFileSystem,
+            mid, (jobject)handle.file);
+    WTF::CheckAndClearException(env);
+    handle = invalidPlatformFileHandle;
 }
 
 int readFromFile(PlatformFileHandle handle, void* data, int length)
@@ -253,6 +428,16 @@ int readFromFile(PlatformFileHandle handle, void* data, int length)
     if (length < 0 || !isHandleValid(handle) || data == nullptr) {
         return -1;
     }
+#if OS(UNIX)
+    if (handle.fd >= 0) {
+        do {
+            auto bytesRead = read(handle.fd, data, static_cast<size_t>(length));
+            if (bytesRead >= 0)
+                return bytesRead;
+        } while (errno == EINTR);
+        return -1;
+    }
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID mid = env->GetStaticMethodID(
             comSunWebkitFileSystem,
@@ -260,11 +445,48 @@ int readFromFile(PlatformFileHandle handle, void* data, int length)
             "(Ljava/io/RandomAccessFile;Ljava/nio/ByteBuffer;)I");
     ASSERT(mid);
 
+    JLObject buffer(env->NewDirectByteBuffer(data, length));
+    int result = env->CallStaticIntMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle.file,
+            (jobject)buffer);
+    WTF::CheckAndClearException(env);
+
+    if (result < 0) {
+        return -1;
+    }
+    return result;
+}
+
+int writeToFile(PlatformFileHandle handle, const void* data, int length)
+{
+    if (length < 0 || !isHandleValid(handle) || data == nullptr) {
+        return -1;
+    }
+#if OS(UNIX)
+    if (handle.fd >= 0) {
+        do {
+            auto bytesWritten = write(handle.fd, data, static_cast<size_t>(length));
+            if (bytesWritten >= 0)
+                return bytesWritten;
+        } while (errno == EINTR);
+        return -1;
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkWriteToFile",
+            "(Ljava/io/RandomAccessFile;Ljava/nio/ByteBuffer;)I");
+    ASSERT(mid);
+
+    JLObject buffer(env->NewDirectByteBuffer(const_cast<void*>(data), length));
     int result = env->CallStaticIntMethod(
             comSunWebkitFileSystem,
             mid,
-            (jobject)handle,
-            (jobject)(env->NewDirectByteBuffer(data, length)));
+            (jobject)handle.file,
+            (jobject)buffer);
     WTF::CheckAndClearException(env);
 
     if (result < 0) {
@@ -275,6 +497,10 @@ int readFromFile(PlatformFileHandle handle, void* data, int length)
 
 String pathGetFileName(const String& path)
 {
+#if OS(UNIX)
+    if (useNativeFileAccess())
+        return pathFileName(path);
+#endif
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetStaticMethodID(
@@ -292,11 +518,31 @@ String pathGetFileName(const String& path)
     return String(env, result);
 }
 
-long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
+long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin origin)
 {
-    // we always get positive value for offset from webkit.
-    // Below check for offset < 0 might be redundant?
-    if (offset < 0 || !isHandleValid(handle)) {
+    if (!isHandleValid(handle)) {
+        return -1;
+    }
+#if OS(UNIX)
+    if (handle.fd >= 0) {
+        int whence = SEEK_SET;
+        switch (origin) {
+        case FileSeekOrigin::Beginning:
+            whence = SEEK_SET;
+            break;
+        case FileSeekOrigin::Current:
+            whence = SEEK_CUR;
+            break;
+        case FileSeekOrigin::End:
+            whence = SEEK_END;
+            break;
+        }
+        return static_cast<long long>(lseek(handle.fd, offset, whence));
+    }
+#endif
+    // RandomAccessFile only seeks to an absolute position, which is all
+    // WebKit asks of this fallback.
+    if (offset < 0 || origin != FileSeekOrigin::Beginning) {
         return -1;
     }
     JNIEnv* env = WTF::GetJavaEnv();
@@ -309,85 +555,197 @@ long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
     env->CallStaticVoidMethod(
             comSunWebkitFileSystem,
             mid,
-            (jobject)handle, (jlong)offset);
+            (jobject)handle.file, (jlong)offset);
     if (WTF::CheckAndClearException(env)) {
         offset = -1;
     }
     return offset;
 }
 
-
-// -----------------------------------------------------------------------
-// Below methods are stubs as of now.
-// TODO: Implement the functionality in future using Java calls as and
-// when needed.
-// -----------------------------------------------------------------------
-std::optional<WallTime> fileCreationTime(const String&) // Not all platforms store file creation time.
+bool truncateFile(PlatformFileHandle handle, long long offset)
 {
-    fprintf(stderr, "fileCreationTime(const String&) NOT IMPLEMENTED\n");
-    return { };
+    if (offset < 0 || !isHandleValid(handle)) {
+        return false;
+    }
+#if OS(UNIX)
+    if (handle.fd >= 0) {
+        return !ftruncate(handle.fd, offset);
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkTruncateFile",
+            "(Ljava/io/RandomAccessFile;J)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle.file, (jlong)offset);
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
 }
 
-String homeDirectoryPath()
+bool flushFile(PlatformFileHandle handle)
 {
-    fprintf(stderr, "homeDirectoryPath() NOT IMPLEMENTED\n");
-    return String();
+    if (!isHandleValid(handle)) {
+        return false;
+    }
+#if OS(UNIX)
+    if (handle.fd >= 0) {
+        return !fsync(handle.fd);
+    }
+#endif
+    // Writes through RandomAccessFile are not buffered on the Java side.
+    return true;
 }
 
-String directoryName(String const &)
+std::optional<uint64_t> fileSize(PlatformFileHandle handle)
 {
-    fprintf(stderr, "directoryName(String const &) NOT IMPLEMENTED\n");
-    return String();
+    if (!isHandleValid(handle)) {
+        return std::nullopt;
+    }
+#if OS(UNIX)
+    if (handle.fd >= 0) {
+        struct stat fileInfo;
+        if (fstat(handle.fd, &fileInfo))
+            return std::nullopt;
+        return fileInfo.st_size;
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkGetFileLength",
+            "(Ljava/io/RandomAccessFile;)J");
+    ASSERT(mid);
+
+    jlong size = env->CallStaticLongMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jobject)handle.file);
+    if (WTF::CheckAndClearException(env) || size < 0) {
+        return std::nullopt;
+    }
+    return size;
 }
 
-Vector<String> listDirectory(const String&, const String&)
+std::optional<PlatformFileID> fileID(PlatformFileHandle handle)
 {
-    fprintf(stderr, "listDirectory(const String&, const String&) NOT IMPLEMENTED\n");
-    Vector<String> entities;
-    return entities;
+#if OS(UNIX)
+    if (isHandleValid(handle) && handle.fd >= 0) {
+        struct stat fileInfo;
+        if (fstat(handle.fd, &fileInfo))
+            return std::nullopt;
+        return fileInfo.st_ino;
+    }
+#else
+    UNUSED_PARAM(handle);
+#endif
+    return std::nullopt;
 }
 
-Vector<String> listDirectory(const String&)
+bool fileIDsAreEqual(std::optional<PlatformFileID> a, std::optional<PlatformFileID> b)
 {
-    fprintf(stderr, "listDirectory(const String&) NOT IMPLEMENTED\n");
-    Vector<String> entities;
-    return entities;
+    return a == b;
 }
 
-int writeToFile(PlatformFileHandle, const void* data, int length)
+std::optional<Vector<uint8_t>> readEntireFile(PlatformFileHandle handle)
 {
-    fprintf(stderr, "writeToFile(PlatformFileHandle, const void* data, int length) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(data);
-    UNUSED_PARAM(length);
+    if (!isHandleValid(handle)) {
+        return std::nullopt;
+    }
+    auto size = fileSize(handle).value_or(0);
+    if (!size) {
+        return std::nullopt;
+    }
 
-    return -1;
-}
+    unsigned bytesToRead;
+    if (!WTF::convertSafely(size, bytesToRead)) {
+        return std::nullopt;
+    }
 
-bool truncateFile(PlatformFileHandle, long long offset)
-{
-    fprintf(stderr, "truncateFile(PlatformFileHandle, long long offset) NOT IMPLEMENTED\n");
+    Vector<uint8_t> buffer(bytesToRead);
+    unsigned totalBytesRead = 0;
+    int bytesRead;
+    while ((bytesRead = readFromFile(handle, buffer.data() + totalBytesRead, bytesToRead - totalBytesRead)) > 0) {
+        totalBytesRead += bytesRead;
+    }
 
-    // FIXME: openjfx2.26 implement truncateFile
-    UNUSED_PARAM(offset);
-    return false;
+    if (totalBytesRead != bytesToRead) {
+        return std::nullopt;
+    }
+    return buffer;
 }
 
-std::optional<int32_t> getFileDeviceId(const String&)
+std::optional<Vector<uint8_t>> readEntireFile(const String& path)
 {
-    fprintf(stderr, "getFileDeviceId(const String&) NOT IMPLEMENTED\n");
-    return {};
+    auto handle = openFile(path, FileOpenMode::Read);
+    auto contents = readEntireFile(handle);
+    closeFile(handle);
+    return contents;
 }
 
-bool MappedFileData::mapFileHandle(PlatformFileHandle, FileOpenMode, MappedFileMode)
+bool MappedFileData::mapFileHandle(PlatformFileHandle handle, FileOpenMode openMode, MappedFileMode mapMode)
 {
-    fprintf(stderr, "MappedFileData::mapFileHandle(PlatformFileHandle handle, MappedFileMode) NOT IMPLEMENTED\n");
+    // A RandomAccessFile handle cannot be mapped; callers fall back to reading.
+    if (!isHandleValid(handle) || handle.fd < 0) {
+        return false;
+    }
+#if OS(UNIX)
+    struct stat fileStat;
+    if (fstat(handle.fd, &fileStat))
+        return false;
+
+    unsigned size;
+    if (!WTF::convertSafely(fileStat.st_size, size))
+        return false;
+
+    if (!size)
+        return true;
+
+    int pageProtection = PROT_READ;
+    switch (openMode) {
+    case FileOpenMode::Read:
+        pageProtection = PROT_READ;
+        break;
+    case FileOpenMode::Truncate:
+        pageProtection = PROT_WRITE;
+        break;
+    case FileOpenMode::ReadWrite:
+        pageProtection = PROT_READ | PROT_WRITE;
+        break;
+#if OS(DARWIN)
+    case FileOpenMode::EventsOnly:
+        ASSERT_NOT_REACHED();
+#endif
+    }
+
+    void* data = mmap(0, size, pageProtection, MAP_FILE | (mapMode == MappedFileMode::Shared ? MAP_SHARED : MAP_PRIVATE), handle.fd, 0);
+    if (data == MAP_FAILED)
+        return false;
+
+    m_fileData = data;
+    m_fileSize = size;
+    return true;
+#else
+    UNUSED_PARAM(openMode);
+    UNUSED_PARAM(mapMode);
     return false;
+#endif
 }
 
-bool unmapViewOfFile(void* , size_t)
+bool unmapViewOfFile(void* buffer, size_t size)
 {
-    fprintf(stderr, "unmapViewOfFile(void* , size_t) NOT IMPLEMENTED()\n");
+#if OS(UNIX)
+    return !munmap(buffer, size);
+#else
+    UNUSED_PARAM(buffer);
+    UNUSED_PARAM(size);
     return false;
+#endif
 }
 
 MappedFileData::~MappedFileData()
@@ -397,135 +755,332 @@ MappedFileData::~MappedFileData()
     unmapViewOfFile(m_fileData, m_fileSize);
 }
 
-bool deleteFile(const String&)
+String pathFileName(const String& path)
 {
-    fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
-    return false;
+    return path.substring(path.reverseFind('/') + 1);
 }
 
-bool deleteEmptyDirectory(String const &)
+String parentPath(const String& path)
 {
-    fprintf(stderr, "deleteEmptyDirectory(String const &) NOT IMPLEMENTED\n");
-    return false;
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        // Matches java.io.File.getParent(): no parent for a bare file name.
+        auto separator = path.reverseFind('/');
+        if (separator == notFound)
+            return String();
+        if (!separator)
+            return path.length() > 1 ? "/"_s : String();
+        return path.left(separator);
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkParentPath",
+            "(Ljava/lang/String;)Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring) path.toJavaString(env)));
+    WTF::CheckAndClearException(env);
+
+    return result ? String(env, result) : String();
 }
 
-String openTemporaryFile(StringView prefix, PlatformFileHandle& handle, StringView suffix)
+Vector<String> listDirectory(const String& path)
 {
-    fprintf(stderr, "openTemporaryFile(const String&, PlatformFileHandle& handle, const String&) NOT IMPLEMENTED\n");
-    handle = invalidPlatformFileHandle;
-        UNUSED_PARAM(prefix);
-        UNUSED_PARAM(suffix);
-    return String();
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        Vector<String> fileNames;
+        auto fsRep = fileSystemRepresentation(path);
+        if (fsRep.isNull())
+            return fileNames;
+        DIR* dir = opendir(fsRep.data());
+        if (!dir)
+            return fileNames;
+        while (auto* entry = readdir(dir)) {
+            const char* name = entry->d_name;
+            if (!strcmp(name, ".") || !strcmp(name, ".."))
+                continue;
+            auto fileName = String::fromUTF8(name);
+            if (!fileName.isNull())
+                fileNames.append(WTFMove(fileName));
+        }
+        closedir(dir);
+        return fileNames;
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkListDirectory",
+            "(Ljava/lang/String;)[Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLObjectArray result = static_cast<jobjectArray>(env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring) path.toJavaString(env)));
+    WTF::CheckAndClearException(env);
+
+    Vector<String> fileNames;
+    if (!result) {
+        return fileNames;
+    }
+    jsize length = env->GetArrayLength(result);
+    fileNames.reserveInitialCapacity(length);
+    for (jsize i = 0; i < length; i++) {
+        JLString fileName = static_cast<jstring>(env->GetObjectArrayElement(result, i));
+        fileNames.append(String(env, fileName));
+    }
+    return fileNames;
 }
 
-String parentPath(const String& path)
+static std::optional<FileType> fileTypePotentiallyFollowingSymLinks(const String& path, bool followLinks)
 {
-    fprintf(stderr, "parentPath(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return String();
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        struct stat fileInfo;
+        if (fsRep.isNull() || (followLinks ? stat(fsRep.data(), &fileInfo) : lstat(fsRep.data(), &fileInfo)))
+            return std::nullopt;
+        return toFileType(fileInfo);
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkGetFileType",
+            "(Ljava/lang/String;Z)I");
+    ASSERT(mid);
+
+    jint result = env->CallStaticIntMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring) path.toJavaString(env),
+            bool_to_jbool(followLinks));
+    if (WTF::CheckAndClearException(env) || result < 0) {
+        return std::nullopt;
+    }
+    return static_cast<FileType>(result);
 }
 
-bool moveFile(const String& oldPath, const String& newPath)
+std::optional<FileType> fileType(const String& path)
 {
-    fprintf(stderr, "moveFile(const String& oldPath, const String& newPath) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(oldPath);
-    UNUSED_PARAM(newPath);
+    return fileTypePotentiallyFollowingSymLinks(path, false);
+}
 
-    return false;
+std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
+{
+    return fileTypePotentiallyFollowingSymLinks(path, true);
 }
 
-bool isHiddenFile(const String& path)
+bool deleteFile(const String& path)
 {
-    fprintf(stderr, "isHiddenFile(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return false;
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        return !fsRep.isNull() && !unlink(fsRep.data());
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkDeleteFile",
+            "(Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring) path.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
 }
 
-String pathFileName(const String& path)
+bool deleteEmptyDirectory(const String& path)
 {
-    UNUSED_PARAM(path);
-   // return path.substring(path.reverseFind('/') + 1);
-   return nullString();
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        return !fsRep.isNull() && !rmdir(fsRep.data());
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkDeleteEmptyDirectory",
+            "(Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring) path.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
 }
 
-bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
+bool moveFile(const String& oldPath, const String& newPath)
 {
-    fprintf(stderr, "hardLinkOrCopyFile(const String& targetPath, const String& linkPath) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(targetPath);
-    UNUSED_PARAM(linkPath);
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto oldFsRep = fileSystemRepresentation(oldPath);
+        auto newFsRep = fileSystemRepresentation(newPath);
+        if (oldFsRep.isNull() || newFsRep.isNull())
+            return false;
+        if (!rename(oldFsRep.data(), newFsRep.data()))
+            return true;
+        // rename() cannot cross file systems; let Java copy the file instead.
+        if (errno != EXDEV)
+            return false;
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
 
-    return false;
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkMoveFile",
+            "(Ljava/lang/String;Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring) oldPath.toJavaString(env),
+            (jstring) newPath.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
 }
 
-std::optional<FileType> fileTypeFollowingSymlinks(const String& path)
+bool hardLinkOrCopyFile(const String& targetPath, const String& linkPath)
 {
-    fprintf(stderr, "fileTypeFollowingSymlinks(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    return {};
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto targetFsRep = fileSystemRepresentation(targetPath);
+        auto linkFsRep = fileSystemRepresentation(linkPath);
+        if (targetFsRep.isNull() || linkFsRep.isNull())
+            return false;
+        if (!link(targetFsRep.data(), linkFsRep.data()))
+            return true;
+        // Fall back to a copy, e.g. across file systems.
+    }
+#endif
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkHardLinkOrCopyFile",
+            "(Ljava/lang/String;Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring) targetPath.toJavaString(env),
+            (jstring) linkPath.toJavaString(env));
+    WTF::CheckAndClearException(env);
+
+    return jbool_to_bool(result);
 }
 
-std::optional<FileType> fileType(const String& path)
+std::optional<int32_t> getFileDeviceId(const String& path)
 {
-    fprintf(stderr, "fileType(const String& path) NOT IMPLEMENTED\n");
+#if OS(UNIX)
+    if (useNativeFileAccess()) {
+        auto fsRep = fileSystemRepresentation(path);
+        struct stat fileInfo;
+        if (fsRep.isNull() || stat(fsRep.data(), &fileInfo))
+            return std::nullopt;
+        return fileInfo.st_dev;
+    }
+#else
     UNUSED_PARAM(path);
-    return {};
+#endif
+    return std::nullopt;
 }
 
-void deleteAllFilesModifiedSince(const String& path, WallTime t)
+String openTemporaryFile(StringView prefix, PlatformFileHandle& handle, StringView suffix)
 {
-    fprintf(stderr, "deleteAllFilesModifiedSince(const String&, WallTime) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    UNUSED_PARAM(t);
+    handle = invalidPlatformFileHandle;
+#if OS(UNIX)
+    // Suffix is not supported because that's incompatible with mkstemp.
+    ASSERT_UNUSED(suffix, suffix.isEmpty());
+    if (useNativeFileAccess()) {
+        const char* directory = getenv("TMPDIR");
+        CString path = makeString(directory ? directory : "/tmp", '/', prefix, "XXXXXX"_s).utf8();
+        int fd = mkstemp(path.mutableData());
+        if (fd < 0)
+            return String();
+        handle = PlatformFileHandle { fd, nullptr };
+        return String::fromUTF8(path.data());
+    }
+#else
+    UNUSED_PARAM(prefix);
+    UNUSED_PARAM(suffix);
+#endif
+    return String();
 }
 
-bool flushFile(PlatformFileHandle handle)
+
+// -----------------------------------------------------------------------
+// Below methods are stubs as of now.
+// TODO: Implement the functionality in future using Java calls as and
+// when needed.
+// -----------------------------------------------------------------------
+std::optional<WallTime> fileCreationTime(const String&) // Not all platforms store file creation time.
 {
-     fprintf(stderr, "flushFile(PlatformFileHandle) NOT IMPLEMENTED\n");
-     UNUSED_PARAM(handle);
-     return false;
+    fprintf(stderr, "fileCreationTime(const String&) NOT IMPLEMENTED\n");
+    return { };
 }
 
-std::optional<Vector<uint8_t>> readEntireFile(PlatformFileHandle handle)
+String homeDirectoryPath()
 {
-    fprintf(stderr, "readEntireFile(PlatformFileHandle handle) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(handle);
-    Vector<uint8_t> vec;
-    return vec;
+    fprintf(stderr, "homeDirectoryPath() NOT IMPLEMENTED\n");
+    return String();
 }
-std::optional<Vector<uint8_t>> readEntireFile(const String& path)
+
+String directoryName(String const &)
 {
-    fprintf(stderr, "readEntireFile(const String& path) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(path);
-    Vector<uint8_t> vec;
-    return vec;
+    fprintf(stderr, "directoryName(String const &) NOT IMPLEMENTED\n");
+    return String();
 }
 
-bool deleteNonEmptyDirectory(String const &)
+Vector<String> listDirectory(const String&, const String&)
 {
-    fprintf(stderr, "deleteNonEmptyDirectory(String const &) NOT IMPLEMENTED\n");
-    return false;
+    fprintf(stderr, "listDirectory(const String&, const String&) NOT IMPLEMENTED\n");
+    Vector<String> entities;
+    return entities;
 }
 
-std::optional<uint64_t> fileSize(PlatformFileHandle handle)
+bool isHiddenFile(const String& path)
 {
-    long long size = 0;
-    fprintf(stderr, "readEntireFile(PlatformFileHandle) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(handle);
-    return size;
+    fprintf(stderr, "isHiddenFile(const String& path) NOT IMPLEMENTED\n");
+    UNUSED_PARAM(path);
+    return false;
 }
 
-std::optional<PlatformFileID> fileID(PlatformFileHandle fileHandle)
+void deleteAllFilesModifiedSince(const String& path, WallTime t)
 {
-    UNUSED_PARAM(fileHandle);
-    return std::nullopt;
+    fprintf(stderr, "deleteAllFilesModifiedSince(const String&, WallTime) NOT IMPLEMENTED\n");
+    UNUSED_PARAM(path);
+    UNUSED_PARAM(t);
 }
 
-bool fileIDsAreEqual(std::optional<PlatformFileID> a, std::optional<PlatformFileID> b)
+bool deleteNonEmptyDirectory(String const &)
 {
-    fprintf(stderr, "fileIDsAreEqual(std::optional<PlatformFileID> a, std::optional<PlatformFileID> b) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(a);
-    UNUSED_PARAM(b);
-    return true;
+    fprintf(stderr, "deleteNonEmptyDirectory(String const &) NOT IMPLEMENTED\n");
+    return false;
 }
 
 } // namespace FileSystemImpl
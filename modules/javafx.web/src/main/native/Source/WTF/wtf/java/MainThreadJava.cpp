@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include <wtf/java/JavaRef.h>
 #include <wtf/MainThread.h>
 #include <wtf/RunLoop.h>
+#include <wtf/Seconds.h>
 
 #if OS(UNIX)
 #include <pthread.h>
@@ -37,6 +38,7 @@
 namespace WTF {
 static JGClass jMainThreadCls;
 static jmethodID fwkScheduleDispatchFunctions;
+static jmethodID fwkScheduleTimers;
 
 #if OS(UNIX)
 static pthread_t s_mainThread;
@@ -54,6 +56,17 @@ void scheduleDispatchFunctionsOnMainThread()
     }
 }
 
+void scheduleTimersOnMainThread(Seconds delay)
+{
+    AttachThreadAsNonDaemonToJavaEnv autoAttach;
+    JNIEnv* env = autoAttach.env();
+    if (env) {
+        env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleTimers,
+                static_cast<jlong>(std::ceil(delay.milliseconds())));
+        WTF::CheckAndClearException(env);
+    }
+}
+
 void initializeMainThreadPlatform()
 {
     // Initialize the class reference and methodids for the MainThread. The
@@ -88,6 +101,13 @@ void initializeMainThreadPlatform()
 
     ASSERT(fwkScheduleDispatchFunctions);
 
+    fwkScheduleTimers = env->GetStaticMethodID(
+            jMainThreadCls,
+            "fwkScheduleTimers",
+            "(J)V");
+
+    ASSERT(fwkScheduleTimers);
+
 #if OS(UNIX)
     s_mainThread = pthread_self();
 #elif OS(WINDOWS)
@@ -120,6 +140,19 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_MainThread_twkScheduleDispatchFunctio
     RunLoop::main().dispatchFunctionsFromMainThread();
 }
 
+/*
+ * Class:     com_sun_webkit_MainThread
+ * Method:    twkFireTimers
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_com_sun_webkit_MainThread_twkFireTimers
+  (JNIEnv*, jclass)
+{
+#if USE(GENERIC_EVENT_LOOP)
+    RunLoop::main().fireTimersFromMainThread();
+#endif
+}
+
 /*
  * Class:     com_sun_webkit_MainThread
  * Method:    twkSetShutdown
@@ -59,6 +59,7 @@ TextBreakIterator::Backing TextBreakIterator::mapModeToBackingIterator(StringVie
 TextBreakIterator::TextBreakIterator(StringView string, const UChar* priorContext, unsigned priorContextLength, Mode mode, ContentAnalysis contentAnalysis, const AtomString& locale)
     : m_backing(mapModeToBackingIterator(string, priorContext, priorContextLength, mode, contentAnalysis, locale))
     , m_mode(mode)
+    , m_contentAnalysis(contentAnalysis)
     , m_locale(locale)
 {
 }
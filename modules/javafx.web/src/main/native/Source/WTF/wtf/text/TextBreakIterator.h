@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <array>
 #include <mutex>
 #include <optional>
 #include <variant>
@@ -151,29 +152,32 @@ private:
 
     TextBreakIterator take(StringView string, const UChar* priorContext, unsigned priorContextLength, TextBreakIterator::Mode mode, TextBreakIterator::ContentAnalysis contentAnalysis, const AtomString& locale)
     {
-        auto iter = std::find_if(m_unused.begin(), m_unused.end(), [&](TextBreakIterator& candidate) {
+        auto& unused = m_unused[mode.index()];
+        auto iter = std::find_if(unused.begin(), unused.end(), [&](TextBreakIterator& candidate) {
             return candidate.mode() == mode && candidate.contentAnalysis() == contentAnalysis && candidate.locale() == locale;
         });
-        if (iter == m_unused.end())
+        if (iter == unused.end())
             return TextBreakIterator(string, priorContext, priorContextLength, mode, contentAnalysis, locale);
         auto result = WTFMove(*iter);
-        m_unused.remove(iter - m_unused.begin());
+        unused.remove(iter - unused.begin());
         result.setText(string, priorContext, priorContextLength);
         return result;
     }
 
     void put(TextBreakIterator&& iterator)
     {
-        m_unused.append(WTFMove(iterator));
-        if (m_unused.size() > capacity)
-            m_unused.remove(0);
+        auto& unused = m_unused[iterator.mode().index()];
+        unused.append(WTFMove(iterator));
+        if (unused.size() > capacity)
+            unused.remove(0);
     }
 
     TextBreakIteratorCache() = default;
 
+    // Kept per mode so that line breaking in one locale does not evict the
+    // caret and character iterators used while editing, and vice versa.
     static constexpr int capacity = 2;
-    // FIXME: Break this up into different Vectors per mode.
-    Vector<TextBreakIterator, capacity> m_unused;
+    std::array<Vector<TextBreakIterator, capacity>, std::variant_size_v<TextBreakIterator::Mode>> m_unused;
 };
 
 // RAII for TextBreakIterator and TextBreakIteratorCache.
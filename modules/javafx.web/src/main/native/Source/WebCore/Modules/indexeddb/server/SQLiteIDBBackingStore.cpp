@@ -70,6 +70,15 @@ static const int currentMetadataVersion = 1;
 // The IndexedDatabase spec defines the max key generator value as 2^53.
 static const uint64_t maxGeneratorValue = 0x20000000000000;
 
+#if PLATFORM(JAVA)
+static std::atomic<uint64_t> pageCacheSize;
+
+void SQLiteIDBBackingStore::setPageCacheSize(uint64_t size)
+{
+    pageCacheSize = size;
+}
+#endif
+
 #define TABLE_SCHEMA_PREFIX "CREATE TABLE "
 #define V3_RECORDS_TABLE_SCHEMA_SUFFIX " (objectStoreID INTEGER NOT NULL ON CONFLICT FAIL, key TEXT COLLATE IDBKEY NOT NULL ON CONFLICT FAIL, value NOT NULL ON CONFLICT FAIL, recordID INTEGER PRIMARY KEY)"_s
 #define V3_INDEX_RECORDS_TABLE_SCHEMA_SUFFIX " (indexID INTEGER NOT NULL ON CONFLICT FAIL, objectStoreID INTEGER NOT NULL ON CONFLICT FAIL, key TEXT COLLATE IDBKEY NOT NULL ON CONFLICT FAIL, value TEXT COLLATE IDBKEY NOT NULL ON CONFLICT FAIL, objectStoreRecordID INTEGER NOT NULL ON CONFLICT FAIL)"_s;
@@ -990,6 +999,14 @@ IDBError SQLiteIDBBackingStore::getOrEstablishDatabaseInfo(IDBDatabaseInfo& info
     m_sqliteDB->disableThreadingChecks();
     m_sqliteDB->enableAutomaticWALTruncation();
 
+#if PLATFORM(JAVA)
+    // The database is in WAL mode, where NORMAL only syncs on checkpoints
+    // instead of on every committed IDB transaction.
+    m_sqliteDB->setSynchronous(SQLiteDatabase::SyncNormal);
+    if (uint64_t cacheSize = pageCacheSize)
+        m_sqliteDB->executeCommandSlow(makeString("PRAGMA cache_size = -", cacheSize / 1024));
+#endif
+
     m_sqliteDB->setCollationFunction("IDBKEY"_s, [](int aLength, const void* a, int bLength, const void* b) {
         return idbKeyCollate(aLength, a, bLength, b);
     });
@@ -100,6 +100,11 @@ public:
     WEBCORE_EXPORT static String decodeDatabaseName(const String& encodedDatabaseName);
 
     WEBCORE_EXPORT static std::optional<IDBDatabaseNameAndVersion> databaseNameAndVersionFromFile(const String&);
+
+#if PLATFORM(JAVA)
+    // Size in bytes of the page cache of each database, 0 for the SQLite default.
+    WEBCORE_EXPORT static void setPageCacheSize(uint64_t);
+#endif
     void handleLowMemoryWarning() final;
 
 private:
@@ -9,9 +9,18 @@ list(APPEND PAL_INCLUDE_DIRECTORIES
     "${ICU_INCLUDE_DIRS}"
 )
 
-list(APPEND PAL_SOURCES
-    crypto/java/CryptoDigestJava.cpp
-)
+if (USE_OPENSSL)
+    list(APPEND PAL_SOURCES
+        crypto/openssl/CryptoDigestOpenSSL.cpp
+    )
+    list(APPEND PAL_LIBRARIES
+        OpenSSL::Crypto
+    )
+else ()
+    list(APPEND PAL_SOURCES
+        crypto/java/CryptoDigestJava.cpp
+    )
+endif ()
 
 add_definitions(-DSTATICALLY_LINKED_WITH_JavaScriptCore)
 add_definitions(-DSTATICALLY_LINKED_WITH_WTF)
@@ -74,4 +74,36 @@ inline void copyASCIIMachineWord(UChar* destination, const uint8_t* source)
     UCharByteFiller<sizeof(WTF::MachineWord)>::copy(destination, source);
 }
 
+// Copies the ASCII prefix of [source, end) in 16 byte blocks and returns the
+// number of bytes copied. The tail that is left is either shorter than a block
+// or starts with a block containing a non-ASCII byte; callers finish it with
+// the machine word path.
+template<typename CharacterType>
+inline size_t copyASCIIBlocks(CharacterType* destination, const uint8_t* source, const uint8_t* end)
+{
+#if CPU(X86_SSE2)
+    const uint8_t* start = source;
+    while (end - source >= static_cast<ptrdiff_t>(sizeof(__m128i))) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        if (_mm_movemask_epi8(block))
+            break;
+        if constexpr (sizeof(CharacterType) == sizeof(LChar))
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), block);
+        else {
+            __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_unpacklo_epi8(block, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 8), _mm_unpackhi_epi8(block, zero));
+        }
+        source += sizeof(__m128i);
+        destination += sizeof(__m128i);
+    }
+    return source - start;
+#else
+    UNUSED_PARAM(destination);
+    UNUSED_PARAM(source);
+    UNUSED_PARAM(end);
+    return 0;
+#endif
+}
+
 } // namespace PAL
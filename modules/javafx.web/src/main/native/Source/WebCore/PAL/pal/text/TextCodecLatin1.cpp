@@ -112,6 +112,14 @@ String TextCodecLatin1::decode(const char* bytes, size_t length, bool, bool, boo
     while (source < end) {
         if (isASCII(*source)) {
             // Fast path for ASCII. Most Latin-1 text will be ASCII.
+            if (size_t asciiLength = copyASCIIBlocks(destination, source, end)) {
+                source += asciiLength;
+                destination += asciiLength;
+                if (source == end)
+                    break;
+                if (!isASCII(*source))
+                    goto useLookupTable;
+            }
             if (WTF::isAlignedToMachineWord(source)) {
                 while (source < alignedEnd) {
                     auto chunk = *reinterpret_cast_ptr<const WTF::MachineWord*>(source);
@@ -167,6 +175,14 @@ upConvertTo16Bit:
     while (source < end) {
         if (isASCII(*source)) {
             // Fast path for ASCII. Most Latin-1 text will be ASCII.
+            if (size_t asciiLength = copyASCIIBlocks(destination16, source, end)) {
+                source += asciiLength;
+                destination16 += asciiLength;
+                if (source == end)
+                    break;
+                if (!isASCII(*source))
+                    goto useLookupTable16;
+            }
             if (WTF::isAlignedToMachineWord(source)) {
                 while (source < alignedEnd) {
                     auto chunk = *reinterpret_cast_ptr<const WTF::MachineWord*>(source);
@@ -323,6 +323,11 @@ String TextCodecUTF8::decode(const char* bytes, size_t length, bool flush, bool
         while (source < end) {
             if (isASCII(*source)) {
                 // Fast path for ASCII. Most UTF-8 text will be ASCII.
+                if (size_t asciiLength = copyASCIIBlocks(destination, source, end)) {
+                    source += asciiLength;
+                    destination += asciiLength;
+                    continue;
+                }
                 if (WTF::isAlignedToMachineWord(source)) {
                     while (source < alignedEnd) {
                         auto chunk = *reinterpret_cast_ptr<const WTF::MachineWord*>(source);
@@ -403,6 +408,11 @@ upConvertTo16Bit:
         while (source < end) {
             if (isASCII(*source)) {
                 // Fast path for ASCII. Most UTF-8 text will be ASCII.
+                if (size_t asciiLength = copyASCIIBlocks(destination16, source, end)) {
+                    source += asciiLength;
+                    destination16 += asciiLength;
+                    continue;
+                }
                 if (WTF::isAlignedToMachineWord(source)) {
                     while (source < alignedEnd) {
                         auto chunk = *reinterpret_cast_ptr<const WTF::MachineWord*>(source);
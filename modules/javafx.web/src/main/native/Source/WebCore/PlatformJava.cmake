@@ -1,5 +1,12 @@
 include(platform/TextureMapper.cmake)
 
+if (USE_OPENSSL)
+    include(platform/OpenSSL.cmake)
+    list(APPEND WebCore_LIBRARIES
+        OpenSSL::Crypto
+    )
+endif ()
+
 set(WebCore_OUTPUT_NAME WebCore)
 
 # JDK-9 +
@@ -90,14 +97,18 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     bindings/java/JavaEventListener.h
     bindings/java/EventListenerManager.h
     bindings/java/JavaNodeFilterCondition.h
+    bindings/java/ScriptBytecodeCacheJava.h
     bridge/jni/jsc/BridgeUtils.h
     dom/DOMStringList.h
+    platform/RunLoopObserver.h
+    platform/graphics/java/GlyphMetricsCacheJava.h
     platform/graphics/java/ImageBufferJavaBackend.h
     platform/graphics/java/ImageJava.h
     platform/graphics/java/PlatformContextJava.h
     platform/graphics/java/PathJava.h
     platform/graphics/java/RQRef.h
     platform/graphics/java/RenderingQueue.h
+    platform/graphics/java/TextShapingCacheJava.h
     platform/graphics/texmap/BitmapTextureJava.h
     platform/graphics/texmap/TextureMapperJava.h
     platform/java/DataObjectJava.h
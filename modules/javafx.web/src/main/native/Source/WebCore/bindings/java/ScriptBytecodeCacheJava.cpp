@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "ScriptBytecodeCacheJava.h"
+
+#include "CachedScriptSourceProvider.h"
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <wtf/FileSystem.h>
+#include <wtf/HexNumber.h>
+#include <wtf/SHA1.h>
+#include <wtf/URL.h>
+#include <wtf/text/StringConcatenateNumbers.h>
+
+namespace WebCore {
+
+namespace ScriptBytecodeCacheJavaInternal {
+
+// Small scripts are parsed faster than their cache file is opened and mapped.
+static constexpr unsigned minimumSourceLength = 4 * KB;
+
+static constexpr auto fileSuffix = ".bytecode"_s;
+static constexpr auto temporarySuffix = ".tmp"_s;
+
+// Writes the file next to its final location and renames it into place, so
+// that a concurrent reader never maps a partially written file.
+static bool writeFileAtomically(const String& path, const Vector<uint8_t>& contents)
+{
+    String temporaryPath = makeString(path, temporarySuffix);
+    auto handle = FileSystem::openFile(temporaryPath, FileSystem::FileOpenMode::Truncate);
+    if (!FileSystem::isHandleValid(handle))
+        return false;
+
+    bool success = FileSystem::writeToFile(handle, contents.data(), contents.size()) == static_cast<int>(contents.size());
+    FileSystem::closeFile(handle);
+    if (!success || !FileSystem::moveFile(temporaryPath, path)) {
+        FileSystem::deleteFile(temporaryPath);
+        return false;
+    }
+    return true;
+}
+
+// Removes the entries a script had for earlier versions of its source.
+static void removeOtherVersions(const String& directory, const String& fileName)
+{
+    auto urlKeyLength = fileName.find('-');
+    if (urlKeyLength == notFound)
+        return;
+    StringView urlKey = StringView(fileName).left(urlKeyLength + 1);
+    for (auto& name : FileSystem::listDirectory(directory)) {
+        if (name != fileName && name.startsWith(urlKey))
+            FileSystem::deleteFile(FileSystem::pathByAppendingComponent(directory, name));
+    }
+}
+
+} // namespace ScriptBytecodeCacheJavaInternal
+
+ScriptBytecodeCacheJava& ScriptBytecodeCacheJava::singleton()
+{
+    static NeverDestroyed<ScriptBytecodeCacheJava> cache;
+    return cache;
+}
+
+void ScriptBytecodeCacheJava::setDirectory(const String& directory)
+{
+    ASSERT(isMainThread());
+    // Pending bytecode of the pages loaded so far belongs to the first
+    // directory, see the class comment.
+    if (isEnabled() || directory.isEmpty() || !FileSystem::makeAllDirectories(directory))
+        return;
+    m_directory = directory;
+    m_queue = WorkQueue::create("com.sun.webkit.ScriptBytecodeCache");
+}
+
+String ScriptBytecodeCacheJava::pathForScript(const URL& url, unsigned sourceHash, unsigned sourceLength) const
+{
+    using namespace ScriptBytecodeCacheJavaInternal;
+    if (!isEnabled() || sourceLength < minimumSourceLength)
+        return String();
+    if (!url.protocolIsInHTTPFamily() && !url.protocolIsFile())
+        return String();
+
+    URL key = url;
+    key.removeFragmentIdentifier();
+    SHA1 sha1;
+    sha1.addBytes(key.string().utf8());
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return FileSystem::pathByAppendingComponent(m_directory,
+        makeString(SHA1::hexDigest(digest).data(), '-', hex(sourceHash, 8), fileSuffix));
+}
+
+RefPtr<JSC::CachedBytecode> ScriptBytecodeCacheJava::retrieve(const String& path)
+{
+    ASSERT(isMainThread());
+    auto mappedFile = FileSystem::MappedFileData::create(path, FileSystem::MappedFileMode::Private);
+    if (!mappedFile || !mappedFile->size())
+        return nullptr;
+    m_retrievedCount++;
+    return JSC::CachedBytecode::create(WTFMove(*mappedFile));
+}
+
+void ScriptBytecodeCacheJava::store(const String& path, const JSC::CachedBytecode& bytecode)
+{
+    using namespace ScriptBytecodeCacheJavaInternal;
+    ASSERT(isMainThread() && m_queue);
+
+    // The bytecode is not thread safe, so it is flattened here and the
+    // copy is handed to the queue. Updates patch the mapped base and
+    // append to it, as JavaScriptCore lays them out for a file.
+    Vector<uint8_t> contents(bytecode.sizeForUpdate());
+    memcpy(contents.data(), bytecode.data(), bytecode.size());
+    bytecode.commitUpdates([&contents] (off_t offset, const void* data, size_t size) {
+        RELEASE_ASSERT(offset >= 0 && static_cast<size_t>(offset) + size <= contents.size());
+        memcpy(contents.data() + offset, data, size);
+    });
+
+    m_queue->dispatch([directory = m_directory.isolatedCopy(), path = path.isolatedCopy(), contents = WTFMove(contents)] {
+        if (writeFileAtomically(path, contents))
+            removeOtherVersions(directory, FileSystem::pathFileName(path));
+    });
+}
+
+void ScriptBytecodeCacheJava::storePendingBytecode()
+{
+    ASSERT(isMainThread());
+    for (auto* provider : copyToVector(m_pendingProviders))
+        provider->commitCachedBytecode();
+    ASSERT(m_pendingProviders.isEmpty());
+}
+
+// CachedScriptSourceProvider keeps the bytecode of its script in the cache
+// above, the same way the jsc shell does for its disk cache.
+
+const String& CachedScriptSourceProvider::bytecodeCachePath() const
+{
+    if (!m_bytecodeCachePath) {
+        auto& cache = ScriptBytecodeCacheJava::singleton();
+        m_bytecodeCachePath = cache.isEnabled() ? cache.pathForScript(m_cachedScript->response().url(), hash(), source().length()) : String();
+    }
+    return *m_bytecodeCachePath;
+}
+
+RefPtr<JSC::CachedBytecode> CachedScriptSourceProvider::cachedBytecode() const
+{
+    if (!m_cachedBytecode && !bytecodeCachePath().isNull())
+        m_cachedBytecode = ScriptBytecodeCacheJava::singleton().retrieve(bytecodeCachePath());
+    return m_cachedBytecode;
+}
+
+void CachedScriptSourceProvider::cacheBytecode(const BytecodeCacheGenerator& generator) const
+{
+    if (bytecodeCachePath().isNull())
+        return;
+    // The code cache only asks for global bytecode it could not find, so a
+    // mapped entry for this source was not usable and is replaced.
+    if (!m_cachedBytecode || m_cachedBytecode->size())
+        m_cachedBytecode = JSC::CachedBytecode::create();
+    if (auto update = generator()) {
+        m_cachedBytecode->addGlobalUpdate(*update);
+        ScriptBytecodeCacheJava::singleton().addPendingProvider(*this);
+    }
+}
+
+void CachedScriptSourceProvider::updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const
+{
+    if (!m_cachedBytecode || bytecodeCachePath().isNull())
+        return;
+    JSC::BytecodeCacheError error;
+    auto cachedBytecode = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (cachedBytecode && !error.isValid()) {
+        m_cachedBytecode->addFunctionUpdate(executable, kind, *cachedBytecode);
+        ScriptBytecodeCacheJava::singleton().addPendingProvider(*this);
+    }
+}
+
+void CachedScriptSourceProvider::commitCachedBytecode() const
+{
+    if (!m_cachedBytecode || !m_cachedBytecode->hasUpdates())
+        return;
+    auto& cache = ScriptBytecodeCacheJava::singleton();
+    cache.removePendingProvider(*this);
+    cache.store(bytecodeCachePath(), *m_cachedBytecode);
+    m_cachedBytecode = nullptr;
+}
+
+} // namespace WebCore
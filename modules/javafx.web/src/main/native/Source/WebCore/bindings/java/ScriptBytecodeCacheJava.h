@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <wtf/Forward.h>
+#include <wtf/HashSet.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WorkQueue.h>
+
+namespace JSC {
+class CachedBytecode;
+}
+
+namespace WebCore {
+
+class CachedScriptSourceProvider;
+
+// Persistent store for the bytecode JavaScriptCore generates for external
+// scripts. An entry is a single file named after the script URL and the
+// hash of its source, so that an edited script gets a new file. Entries
+// are memory mapped when the script is evaluated again; JavaScriptCore
+// rejects entries written by another build or for different source.
+//
+// The cache is disabled until a directory is set, which WebEngine does
+// for its user data directory when the "com.sun.webkit.bytecodeCache"
+// system property is true. Scripts and their providers are shared by all
+// pages through the memory cache, so the cache is process wide as well:
+// the first directory set is used for the lifetime of the process, and
+// the user data directories of later engines do not move it.
+// Bytecode is written when its script provider goes away, or when a page
+// is destroyed for the scripts still alive. Lookups happen on the main
+// thread, writes on a work queue.
+class ScriptBytecodeCacheJava {
+    WTF_MAKE_NONCOPYABLE(ScriptBytecodeCacheJava);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    WEBCORE_EXPORT static ScriptBytecodeCacheJava& singleton();
+
+    WEBCORE_EXPORT void setDirectory(const String&);
+    bool isEnabled() const { return !!m_queue; }
+
+    // Returns a null string if the script should not be cached.
+    String pathForScript(const URL&, unsigned sourceHash, unsigned sourceLength) const;
+
+    RefPtr<JSC::CachedBytecode> retrieve(const String& path);
+    // Number of entries mapped so far, for tests.
+    unsigned retrievedCount() const { return m_retrievedCount; }
+    void store(const String& path, const JSC::CachedBytecode&);
+
+    void addPendingProvider(const CachedScriptSourceProvider& provider) { m_pendingProviders.add(&provider); }
+    void removePendingProvider(const CachedScriptSourceProvider& provider) { m_pendingProviders.remove(&provider); }
+    WEBCORE_EXPORT void storePendingBytecode();
+
+private:
+    friend class NeverDestroyed<ScriptBytecodeCacheJava>;
+    ScriptBytecodeCacheJava() = default;
+
+    String m_directory;
+    RefPtr<WorkQueue> m_queue;
+    HashSet<const CachedScriptSourceProvider*> m_pendingProviders;
+    unsigned m_retrievedCount { 0 };
+};
+
+} // namespace WebCore
@@ -578,6 +578,22 @@ public class NodeImpl extends JSObject implements Node, EventTarget {
         , long event);
 
 
+// Snapshots
+    /**
+     * Returns a snapshot of the subtree rooted at this node, taken with a
+     * single call into WebKit. The snapshot holds the node types, names,
+     * values and attributes and, if {@code includeLayout} is true, the
+     * bounding box of every rendered node in document coordinates. It is
+     * not updated when the document changes.
+     */
+    public NodeSnapshot snapshot(boolean includeLayout) {
+        return NodeSnapshot.decode(snapshotImpl(getPeer()
+            , includeLayout));
+    }
+    native static byte[] snapshotImpl(long peer
+        , boolean includeLayout);
+
+
 
 //stubs
     @Override
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.dom;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import org.w3c.dom.DOMException;
+import org.w3c.dom.Element;
+import org.w3c.dom.Node;
+
+/**
+ * A list of DOM mutations that is applied with a single call into WebKit.
+ * Mutations are applied in the order they are added.
+ */
+public final class NodeMutationBatch {
+    // Must match NodeMutation in JavaNode.cpp
+    private static final byte SET_ATTRIBUTE = 0;
+    private static final byte REMOVE_ATTRIBUTE = 1;
+    private static final byte SET_TEXT_CONTENT = 2;
+    private static final byte APPEND_CHILD = 3;
+    private static final byte REMOVE = 4;
+
+    private byte[] operations = new byte[16];
+    // The nodes are kept so that their peers stay valid until applied
+    private final List<Node> targets = new ArrayList<>();
+    private final List<Node> nodes = new ArrayList<>();
+    private final List<String> names = new ArrayList<>();
+    private final List<String> values = new ArrayList<>();
+
+    public NodeMutationBatch setAttribute(Element element, String name, String value) {
+        return add(SET_ATTRIBUTE, element, null, name, value);
+    }
+
+    public NodeMutationBatch removeAttribute(Element element, String name) {
+        return add(REMOVE_ATTRIBUTE, element, null, name, null);
+    }
+
+    public NodeMutationBatch setTextContent(Node node, String textContent) {
+        return add(SET_TEXT_CONTENT, node, null, null, textContent);
+    }
+
+    public NodeMutationBatch appendChild(Node parent, Node child) {
+        if (child == null) {
+            throw new NullPointerException("child");
+        }
+        return add(APPEND_CHILD, parent, child, null, null);
+    }
+
+    public NodeMutationBatch remove(Node node) {
+        return add(REMOVE, node, null, null, null);
+    }
+
+    public int size() {
+        return targets.size();
+    }
+
+    /**
+     * Applies the mutations and clears the batch. If a mutation fails, the
+     * mutations before it stay applied, the ones after it are dropped and
+     * a {@code DOMException} is thrown.
+     */
+    public void apply() throws DOMException {
+        int count = size();
+        long[] targetPeers = new long[count];
+        long[] nodePeers = new long[count];
+        for (int i = 0; i < count; i++) {
+            targetPeers[i] = NodeImpl.getPeer(targets.get(i));
+            nodePeers[i] = NodeImpl.getPeer(nodes.get(i));
+        }
+        try {
+            applyImpl(Arrays.copyOf(operations, count), targetPeers, nodePeers,
+                    names.toArray(new String[count]),
+                    values.toArray(new String[count]));
+        } finally {
+            targets.clear();
+            nodes.clear();
+            names.clear();
+            values.clear();
+        }
+    }
+
+    private NodeMutationBatch add(byte operation, Node target, Node node,
+                                  String name, String value)
+    {
+        if (target == null) {
+            throw new NullPointerException("target");
+        }
+        int index = targets.size();
+        if (index == operations.length) {
+            operations = Arrays.copyOf(operations, 2 * index);
+        }
+        operations[index] = operation;
+        targets.add(target);
+        nodes.add(node);
+        names.add(name);
+        values.add(value);
+        return this;
+    }
+
+    private native static void applyImpl(byte[] operations, long[] targets,
+            long[] nodes, String[] names, String[] values);
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.dom;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.Deque;
+import java.util.List;
+
+/**
+ * An immutable copy of a DOM subtree, see {@link NodeImpl#snapshot}.
+ *
+ * The native side writes the subtree in document order, in native byte
+ * order. The buffer starts with a byte that is 1 if layout boxes are
+ * included. Every node is written as
+ * <ul>
+ * <li>node type, 16 bits</li>
+ * <li>number of children, 32 bits</li>
+ * <li>node name and node value, as strings</li>
+ * <li>number of attributes, 32 bits, followed by the name and value
+ *     string of each attribute</li>
+ * <li>with layout boxes, a byte that is 1 if the node is rendered,
+ *     followed by x, y, width and height as floats if it is</li>
+ * </ul>
+ * A string is a 32 bit length, -1 for null, followed by that many UTF-16
+ * code units.
+ */
+public final class NodeSnapshot {
+    private static final NodeSnapshot[] NO_CHILDREN = new NodeSnapshot[0];
+    private static final String[] NO_ATTRIBUTES = new String[0];
+
+    private final NodeSnapshot parent;
+    private final short nodeType;
+    private final String nodeName;
+    private final String nodeValue;
+    // Names at even indexes, values at odd indexes
+    private final String[] attributes;
+    private final float[] bounds;
+    private NodeSnapshot[] children;
+
+    private NodeSnapshot(NodeSnapshot parent, short nodeType, String nodeName,
+                         String nodeValue, String[] attributes, float[] bounds)
+    {
+        this.parent = parent;
+        this.nodeType = nodeType;
+        this.nodeName = nodeName;
+        this.nodeValue = nodeValue;
+        this.attributes = attributes;
+        this.bounds = bounds;
+    }
+
+    static NodeSnapshot decode(byte[] data) {
+        if (data == null) {
+            return null;
+        }
+        ByteBuffer buffer = ByteBuffer.wrap(data).order(ByteOrder.nativeOrder());
+        boolean includeLayout = buffer.get() != 0;
+
+        // Nodes whose children are still being read, with the number read
+        Deque<NodeSnapshot> parents = new ArrayDeque<>();
+        Deque<int[]> childIndexes = new ArrayDeque<>();
+        NodeSnapshot root = null;
+        while (buffer.hasRemaining()) {
+            NodeSnapshot parent = parents.peek();
+            short nodeType = buffer.getShort();
+            int childCount = buffer.getInt();
+            String nodeName = readString(buffer);
+            String nodeValue = readString(buffer);
+            int attributeCount = buffer.getInt();
+            String[] attributes = attributeCount == 0
+                    ? NO_ATTRIBUTES : new String[2 * attributeCount];
+            for (int i = 0; i < attributes.length; i++) {
+                attributes[i] = readString(buffer);
+            }
+            float[] bounds = null;
+            if (includeLayout && buffer.get() != 0) {
+                bounds = new float[] {
+                    buffer.getFloat(), buffer.getFloat(),
+                    buffer.getFloat(), buffer.getFloat()
+                };
+            }
+
+            NodeSnapshot node = new NodeSnapshot(parent, nodeType, nodeName,
+                    nodeValue, attributes, bounds);
+            node.children = childCount == 0
+                    ? NO_CHILDREN : new NodeSnapshot[childCount];
+            if (parent == null) {
+                root = node;
+            } else {
+                int[] index = childIndexes.peek();
+                parent.children[index[0]++] = node;
+                if (index[0] == parent.children.length) {
+                    parents.pop();
+                    childIndexes.pop();
+                }
+            }
+            if (childCount > 0) {
+                parents.push(node);
+                childIndexes.push(new int[1]);
+            }
+        }
+        return root;
+    }
+
+    private static String readString(ByteBuffer buffer) {
+        int length = buffer.getInt();
+        if (length < 0) {
+            return null;
+        }
+        char[] chars = new char[length];
+        buffer.asCharBuffer().get(chars);
+        buffer.position(buffer.position() + 2 * length);
+        return new String(chars);
+    }
+
+    public NodeSnapshot getParent() {
+        return parent;
+    }
+
+    public short getNodeType() {
+        return nodeType;
+    }
+
+    public String getNodeName() {
+        return nodeName;
+    }
+
+    public String getNodeValue() {
+        return nodeValue;
+    }
+
+    public int getAttributeCount() {
+        return attributes.length / 2;
+    }
+
+    public String getAttributeName(int index) {
+        return attributes[2 * index];
+    }
+
+    public String getAttributeValue(int index) {
+        return attributes[2 * index + 1];
+    }
+
+    /**
+     * Returns the value of the attribute with the given qualified name,
+     * or null if the node has no such attribute.
+     */
+    public String getAttribute(String name) {
+        for (int i = 0; i < attributes.length; i += 2) {
+            if (attributes[i].equals(name)) {
+                return attributes[i + 1];
+            }
+        }
+        return null;
+    }
+
+    public List<NodeSnapshot> getChildren() {
+        return Collections.unmodifiableList(Arrays.asList(children));
+    }
+
+    /**
+     * Returns whether the node was rendered. Always false if the snapshot
+     * was taken without layout boxes.
+     */
+    public boolean hasBounds() {
+        return bounds != null;
+    }
+
+    public float getX() {
+        return bounds != null ? bounds[0] : 0;
+    }
+
+    public float getY() {
+        return bounds != null ? bounds[1] : 0;
+    }
+
+    public float getWidth() {
+        return bounds != null ? bounds[2] : 0;
+    }
+
+    public float getHeight() {
+        return bounds != null ? bounds[3] : 0;
+    }
+}
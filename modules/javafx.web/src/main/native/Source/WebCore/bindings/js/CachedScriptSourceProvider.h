@@ -40,12 +40,23 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+#if PLATFORM(JAVA)
+        commitCachedBytecode();
+#endif
         m_cachedScript->removeClient(*this);
     }
 
     unsigned hash() const override;
     StringView source() const override;
 
+#if PLATFORM(JAVA)
+    // Implemented in ScriptBytecodeCacheJava.cpp.
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const final;
+    void cacheBytecode(const BytecodeCacheGenerator&) const final;
+    void updateCache(const JSC::UnlinkedFunctionExecutable*, const JSC::SourceCode&, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*) const final;
+    void commitCachedBytecode() const final;
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), TextPosition(), sourceType)
@@ -54,7 +65,15 @@ private:
         m_cachedScript->addClient(*this);
     }
 
+#if PLATFORM(JAVA)
+    const String& bytecodeCachePath() const;
+#endif
+
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(JAVA)
+    mutable std::optional<String> m_bytecodeCachePath;
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+#endif
 };
 
 inline unsigned CachedScriptSourceProvider::hash() const
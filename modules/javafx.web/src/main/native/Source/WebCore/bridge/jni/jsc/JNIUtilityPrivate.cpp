@@ -253,50 +253,49 @@ jvalue convertValueToJValue(JSGlobalObject* globalObject, RootObject* rootObject
 
 jobject jvalueToJObject(jvalue value, JavaType jtype) {
     JNIEnv* env = getJNIEnv();
-    jmethodID meth;
     switch (jtype) {
     case JavaTypeObject:
     case JavaTypeArray:
         return value.l;
     case JavaTypeBoolean: {
       static JGClass clsZ(env->FindClass("java/lang/Boolean"));
-      meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
+      static jmethodID meth = env->GetStaticMethodID(clsZ, "valueOf", "(Z)Ljava/lang/Boolean;");
       return env->CallStaticObjectMethod(clsZ, meth, value.z);
     }
     case JavaTypeChar: {
       static JGClass clsC(env->FindClass("java/lang/Character"));
-      meth = env->GetStaticMethodID(clsC, "valueOf",
-                                    "(C)Ljava/lang/Character;");
+      static jmethodID meth = env->GetStaticMethodID(clsC, "valueOf",
+                                                     "(C)Ljava/lang/Character;");
       return env->CallStaticObjectMethod(clsC, meth, value.c);
     }
     case JavaTypeByte: {
       static JGClass clsB(env->FindClass("java/lang/Byte"));
-      meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
+      static jmethodID meth = env->GetStaticMethodID(clsB, "valueOf", "(B)Ljava/lang/Byte;");
       return env->CallStaticObjectMethod(clsB, meth, value.b);
     }
     case JavaTypeShort: {
       static JGClass clsS(env->FindClass("java/lang/Short"));
-      meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
+      static jmethodID meth = env->GetStaticMethodID(clsS, "valueOf", "(S)Ljava/lang/Short;");
       return env->CallStaticObjectMethod(clsS, meth, value.s);
     }
     case JavaTypeInt: {
       static JGClass clsI(env->FindClass("java/lang/Integer"));
-      meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
+      static jmethodID meth = env->GetStaticMethodID(clsI, "valueOf", "(I)Ljava/lang/Integer;");
       return env->CallStaticObjectMethod(clsI, meth, value.i);
     }
     case JavaTypeLong: {
       static JGClass clsJ(env->FindClass("java/lang/Long"));
-      meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
+      static jmethodID meth = env->GetStaticMethodID(clsJ, "valueOf", "(J)Ljava/lang/Long;");
       return env->CallStaticObjectMethod(clsJ, meth, value.j);
     }
     case JavaTypeFloat: {
       static JGClass clsF(env->FindClass("java/lang/Float"));
-      meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
+      static jmethodID meth = env->GetStaticMethodID(clsF, "valueOf", "(F)Ljava/lang/Float;");
       return env->CallStaticObjectMethod(clsF, meth, value.f);
     }
     case JavaTypeDouble: {
       static JGClass clsD(env->FindClass("java/lang/Double"));
-      meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
+      static jmethodID meth = env->GetStaticMethodID(clsD, "valueOf", "(D)Ljava/lang/Double;");
       return env->CallStaticObjectMethod(clsD, meth, value.d);
     }
     default:
@@ -304,7 +303,59 @@ jobject jvalueToJObject(jvalue value, JavaType jtype) {
     }
 }
 
-jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
+// Converts the boxed result of a reflective call back to a primitive.
+static void jobjectToJValue(JNIEnv* env, jobject r, JavaType returnType, jvalue& result) {
+    if (!r) {
+        memset(&result, 0, sizeof(jvalue));
+        return;
+    }
+
+    static JGClass clsZ(env->FindClass("java/lang/Boolean"));
+    static JGClass clsN(env->FindClass("java/lang/Number"));
+    switch (returnType) {
+    case JavaTypeBoolean: {
+        static jmethodID meth = env->GetMethodID(clsZ, "booleanValue", "()Z");
+        result.z = env->CallBooleanMethod(r, meth);
+        break;
+    }
+    case JavaTypeByte: {
+        static jmethodID meth = env->GetMethodID(clsN, "byteValue", "()B");
+        result.b = env->CallByteMethod(r, meth);
+        break;
+    }
+    case JavaTypeShort: {
+        static jmethodID meth = env->GetMethodID(clsN, "shortValue", "()S");
+        result.s = env->CallShortMethod(r, meth);
+        break;
+    }
+    case JavaTypeInt: {
+        static jmethodID meth = env->GetMethodID(clsN, "intValue", "()I");
+        result.i = env->CallIntMethod(r, meth);
+        break;
+    }
+    case JavaTypeLong: {
+        static jmethodID meth = env->GetMethodID(clsN, "longValue", "()J");
+        result.j = env->CallLongMethod(r, meth);
+        break;
+    }
+    case JavaTypeFloat: {
+        static jmethodID meth = env->GetMethodID(clsN, "floatValue", "()F");
+        result.f = env->CallFloatMethod(r, meth);
+        break;
+    }
+    case JavaTypeDouble: {
+        static jmethodID meth = env->GetMethodID(clsN, "doubleValue", "()D");
+        result.d = env->CallDoubleMethod(r, meth);
+        break;
+    }
+    default:
+        ASSERT_NOT_REACHED();
+        break;
+    }
+    env->DeleteLocalRef(r);
+}
+
+jthrowable dispatchJNICall(int count, RootObject* rootObject, jobject obj, bool isStatic, JavaType returnType, jmethodID methodId, jobject* args, jvalue& result, jobject accessControlContext) {
 
     // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
     JLObject jlinstance(obj, true);
@@ -315,18 +366,34 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     }
 
     JNIEnv* env = getJNIEnv();
-    jclass objClass = env->GetObjectClass(obj);
-    jobject rmethod = env->ToReflectedMethod(objClass, methodId, isStatic);
-    jclass utilityCls = env->FindClass("com/sun/webkit/Utilities");
-    jclass objectCls = env->FindClass("java/lang/Object");
-    jobjectArray argsArray = env->NewObjectArray(count, objectCls, NULL);
-    for (int i = 0;  i < count; i++)
-      env->SetObjectArrayElement(argsArray, i, args[i]);
-    jmethodID invokeMethod =
+    JLClass objClass(env->GetObjectClass(obj));
+    JLObject rmethod(env->ToReflectedMethod(objClass, methodId, isStatic));
+    return dispatchJNICall(count, rootObject, obj, rmethod, returnType, args, result, accessControlContext);
+}
+
+jthrowable dispatchJNICall(int count, RootObject*, jobject obj, jobject reflectedMethod, JavaType returnType, jobject* args, jvalue& result, jobject accessControlContext) {
+
+    // Since obj is WeakGlobalRef, creating a localref to safeguard instance() from GC
+    JLObject jlinstance(obj, true);
+
+    if (!jlinstance) {
+        LOG_ERROR("Could not get javaInstance for %p in JNIUtilityPrivate::dispatchJNICall", (jobject)jlinstance);
+        return NULL;
+    }
+
+    JNIEnv* env = getJNIEnv();
+    static JGClass utilityCls(env->FindClass("com/sun/webkit/Utilities"));
+    static JGClass objectCls(env->FindClass("java/lang/Object"));
+    static jmethodID invokeMethod =
         env->GetStaticMethodID(utilityCls, "fwkInvokeWithContext",
                                "(Ljava/lang/reflect/Method;Ljava/lang/Object;[Ljava/lang/Object;Ljava/security/AccessControlContext;)Ljava/lang/Object;");
+    ASSERT(invokeMethod);
+
+    JLObjectArray argsArray(env->NewObjectArray(count, objectCls, NULL));
+    for (int i = 0;  i < count; i++)
+      env->SetObjectArrayElement(argsArray, i, args[i]);
     jobject r = env->CallStaticObjectMethod(utilityCls, invokeMethod,
-                                            rmethod, obj, argsArray,
+                                            reflectedMethod, obj, static_cast<jobjectArray>(argsArray),
                                             accessControlContext);
 
     jthrowable ex = env->ExceptionOccurred();
@@ -335,6 +402,8 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
     switch (returnType) {
     case JavaTypeVoid:
         {
+            if (r)
+                env->DeleteLocalRef(r);
         }
         break;
     case JavaTypeArray:
@@ -346,31 +415,13 @@ jthrowable dispatchJNICall(int count, RootObject*, jobject obj, bool isStatic, J
         break;
 
     case JavaTypeBoolean:
-        result.z = callJNIMethod<jboolean>(r, "booleanValue", "()Z");
-        break;
-
     case JavaTypeByte:
-        result.b = callJNIMethod<jbyte>(r, "byteValue", "()B");
-        break;
-
     case JavaTypeShort:
-        result.s = callJNIMethod<jshort>(r, "shortValue", "()S");
-        break;
-
     case JavaTypeInt:
-        result.i = callJNIMethod<jint>(r, "intValue", "()I");
-        break;
-
     case JavaTypeLong:
-        result.j = callJNIMethod<jlong>(r, "longValue", "()J");
-        break;
-
     case JavaTypeFloat:
-        result.f = callJNIMethod<jfloat>(r, "floatValue", "()F");
-        break;
-
     case JavaTypeDouble:
-        result.d = callJNIMethod<jdouble>(r, "doubleValue", "()D");
+        jobjectToJValue(env, r, returnType, result);
         break;
 
     case JavaTypeInvalid:
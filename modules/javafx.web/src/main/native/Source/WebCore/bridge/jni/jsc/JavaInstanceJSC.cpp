@@ -241,6 +241,41 @@ JSValue JavaInstance::getMethod(JSGlobalObject* lexicalGlobalObject, PropertyNam
     return JavaRuntimeMethod::create(lexicalGlobalObject, lexicalGlobalObject, propertyName.publicName(), method);
 }
 
+namespace {
+
+// A script may call into Java many times before control returns to the JVM,
+// so the local references created for a call are released when it returns.
+class JNILocalFrame {
+public:
+    JNILocalFrame(JNIEnv* env, jint capacity)
+        : m_env(env)
+        , m_pushed(env->PushLocalFrame(capacity) == JNI_OK)
+    {
+        if (!m_pushed)
+            env->ExceptionClear();
+    }
+
+    ~JNILocalFrame()
+    {
+        pop(nullptr);
+    }
+
+    // Pops the frame, returning a reference to |result| that stays valid.
+    jobject pop(jobject result)
+    {
+        if (!m_pushed)
+            return result;
+        m_pushed = false;
+        return m_env->PopLocalFrame(result);
+    }
+
+private:
+    JNIEnv* m_env;
+    bool m_pushed;
+};
+
+} // namespace
+
 JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* callFrame, RuntimeMethod* runtimeMethod)
 {
     VM& vm = globalObject->vm();
@@ -306,13 +341,13 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         return jsUndefined();
     }
 
-    Vector<jobject> jArgs(count);
+    JNILocalFrame localFrame(getJNIEnv(), 2 * count + 8);
+    Vector<jobject, 8> jArgs(count);
 
     for (int i = 0; i < count; i++) {
-        CString javaClassName = jMethod->parameterAt(i).utf8();
-        JavaType jtype = javaTypeFromClassName(javaClassName.data());
+        JavaType jtype = jMethod->parameterTypeAt(i);
         jvalue jarg = convertValueToJValue(globalObject, m_rootObject.get(),
-            callFrame->argument(i), jtype, javaClassName.data());
+            callFrame->argument(i), jtype, jMethod->parameterClassNameAt(i));
         jArgs[i] = jvalueToJObject(jarg, jtype);
 #if !PLATFORM(JAVA)
         LOG(LiveConnect, "JavaInstance::invokeMethod arg[%d] = %s", i, callFrame->argument(i).toString(globalObject)->value(globalObject).ascii().data());
@@ -342,11 +377,9 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
 
         // const char *callingURL = 0; // FIXME, need to propagate calling URL to Java
-        jmethodID methodId = getMethodID(obj, jMethod->name().utf8().data(), jMethod->signature());
-
-        jthrowable ex = dispatchJNICall(callFrame->argumentCount(), rootObject,
-                                        obj, jMethod->isStatic(),
-                                        jMethod->returnType(), methodId,
+        jthrowable ex = dispatchJNICall(count, rootObject,
+                                        obj, jMethod->reflectedMethod(),
+                                        jMethod->returnType(),
                                         jArgs.data(), result,
                                         accessControlContext());
         if (ex != NULL) {
@@ -358,6 +391,17 @@ JSValue JavaInstance::invokeMethod(JSGlobalObject* globalObject, CallFrame* call
         }
     }
 
+    switch (jMethod->returnType()) {
+    case JavaTypeArray:
+    case JavaTypeObject:
+    case JavaTypeChar:
+        result.l = localFrame.pop(result.l);
+        break;
+    default:
+        localFrame.pop(nullptr);
+        break;
+    }
+
     JSValue resultValue;
     switch (jMethod->returnType()) {
     case JavaTypeVoid:
@@ -26,6 +26,10 @@
 #include "config.h"
 #include "RunLoopObserver.h"
 
+#if PLATFORM(JAVA)
+#include <wtf/RunLoop.h>
+#endif
+
 namespace WebCore {
 
 RunLoopObserver::~RunLoopObserver()
@@ -42,17 +46,31 @@ void RunLoopObserver::runLoopObserverFired()
 }
 
 #if PLATFORM(JAVA)
+// The java event loop cannot be observed, so the observer fires once the
+// main RunLoop has run the functions dispatched so far. A repeating
+// observer is re-armed by the next call to schedule().
 void RunLoopObserver::schedule(PlatformRunLoop, OptionSet<Activity>)
 {
+    if (m_isScheduled)
+        return;
+
+    m_isScheduled = true;
+    RunLoop::main().dispatch([weakThis = WeakPtr { *this }, scheduleCount = ++m_scheduleCount] {
+        if (!weakThis || !weakThis->m_isScheduled || weakThis->m_scheduleCount != scheduleCount)
+            return;
+        weakThis->m_isScheduled = false;
+        weakThis->runLoopObserverFired();
+    });
 }
 
 void RunLoopObserver::invalidate()
 {
+    m_isScheduled = false;
 }
 
 bool RunLoopObserver::isScheduled() const
 {
-    return false;
+    return m_isScheduled;
 }
 #else
 
@@ -29,6 +29,9 @@
 #include <wtf/Noncopyable.h>
 #include <wtf/OptionSet.h>
 #include <wtf/RetainPtr.h>
+#if PLATFORM(JAVA)
+#include <wtf/WeakPtr.h>
+#endif
 
 #if USE(CF)
 using PlatformRunLoopObserver = struct __CFRunLoopObserver*;
@@ -40,7 +43,11 @@ using PlatformRunLoop = void*;
 
 namespace WebCore {
 
-class RunLoopObserver {
+class RunLoopObserver
+#if PLATFORM(JAVA)
+    : public CanMakeWeakPtr<RunLoopObserver>
+#endif
+{
     WTF_MAKE_NONCOPYABLE(RunLoopObserver); WTF_MAKE_FAST_ALLOCATED;
 public:
     using RunLoopObserverCallback = Function<void()>;
@@ -97,6 +104,10 @@ private:
     WellKnownOrder m_order { WellKnownOrder::GraphicsCommit };
     RetainPtr<PlatformRunLoopObserver> m_runLoopObserver;
 #endif
+#if PLATFORM(JAVA)
+    bool m_isScheduled { false };
+    unsigned m_scheduleCount { 0 };
+#endif
 };
 
 } // namespace WebCore
@@ -410,10 +410,14 @@ void BitmapImage::startTimer(Seconds delay)
 
 SubsamplingLevel BitmapImage::subsamplingLevelForScaleFactor(GraphicsContext& context, const FloatSize& scaleFactor)
 {
+#if USE(CG) || PLATFORM(JAVA)
 #if USE(CG)
     // Never use subsampled images for drawing into PDF contexts.
     if (context.hasPlatformContext() && CGContextGetType(context.platformContext()) == kCGContextTypePDF)
         return SubsamplingLevel::Default;
+#else
+    UNUSED_PARAM(context);
+#endif
 
     float scale = std::min(float(1), std::max(scaleFactor.width(), scaleFactor.height()));
     if (!(scale > 0 && scale <= 1))
@@ -52,8 +52,10 @@
 #endif
 
 #if PLATFORM(JAVA)
+#include "GlyphMetricsCacheJava.h"
 #include "PlatformJavaClasses.h"
 #include "RQRef.h"
+#include "TextShapingCacheJava.h"
 #endif
 
 #if USE(APPKIT)
@@ -226,6 +228,18 @@ public:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> nativeFontData() const { return m_jFont; }
+    GlyphMetricsCacheJava& glyphMetricsCache() const
+    {
+        if (!m_glyphMetricsCache)
+            m_glyphMetricsCache = GlyphMetricsCacheJava::create();
+        return *m_glyphMetricsCache;
+    }
+    TextShapingCacheJava& textShapingCache() const
+    {
+        if (!m_textShapingCache)
+            m_textShapingCache = TextShapingCacheJava::create();
+        return *m_textShapingCache;
+    }
 #endif
 
     unsigned hash() const;
@@ -313,6 +327,8 @@ private:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> m_jFont;
+    mutable RefPtr<GlyphMetricsCacheJava> m_glyphMetricsCache;
+    mutable RefPtr<TextShapingCacheJava> m_textShapingCache;
 #endif
 
     float m_size { 0 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -124,40 +124,21 @@ RefPtr<Font> Font::platformCreateScaledFont(const FontDescription&, float scaleF
 
 float Font::platformWidthForGlyph(Glyph c) const
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-
     RefPtr<RQRef> jFont = m_platformData.nativeFontData();
     if (!jFont)
         return 0.0f;
 
-    static jmethodID getGlyphWidth_mID = env->GetMethodID(PG_GetFontClass(env),
-        "getGlyphWidth", "(I)D");
-    ASSERT(getGlyphWidth_mID);
-
-    float res = env->CallDoubleMethod(*jFont, getGlyphWidth_mID, (jint)c);
-    WTF::CheckAndClearException(env);
-
-    return res;
+    return m_platformData.glyphMetricsCache().widthForGlyph(*jFont, c);
 }
 
 FloatRect Font::platformBoundsForGlyph(Glyph c) const
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-
     RefPtr<RQRef> jFont = m_platformData.nativeFontData();
     if (!jFont) {
         return {};
     }
 
-    static jmethodID getGlyphBoundingBox_mID = env->GetMethodID(PG_GetFontClass(env), "getGlyphBoundingBox", "(I)[F");
-    ASSERT(getGlyphBoundingBox_mID);
-
-    jfloatArray boundingBox = (jfloatArray)env->CallObjectMethod(*jFont, getGlyphBoundingBox_mID, (jint)c);
-    jfloat *bBox = env->GetFloatArrayElements(boundingBox,0);
-    auto bb = FloatRect { bBox[0], bBox[1], bBox[2], bBox[3] };
-    env->ReleaseFloatArrayElements(boundingBox, bBox, 0);
-    WTF::CheckAndClearException(env);
-    return bb;
+    return m_platformData.glyphMetricsCache().boundsForGlyph(*jFont, c);
 }
 
 Path Font::platformPathForGlyph(Glyph) const
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "GlyphMetricsCacheJava.h"
+#include "PlatformJavaClasses.h"
+
+#include <wtf/java/JavaRef.h>
+
+namespace WebCore {
+
+const GlyphMetricsCacheJava::WidthPage* GlyphMetricsCacheJava::widthPage(RQRef& jFont, unsigned pageNumber)
+{
+    auto it = m_widthPages.find(pageNumber);
+    if (it != m_widthPages.end())
+        return it->value.get();
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID getGlyphWidths_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphWidths", "(IILjava/nio/ByteBuffer;)V");
+    ASSERT(getGlyphWidths_mID);
+
+    auto page = makeUnique<WidthPage>();
+    page->fill(0);
+    JLObject jWidths(env->NewDirectByteBuffer(page->data(), sizeof(WidthPage)));
+    WTF::CheckAndClearException(env); // OOME
+    if (!jWidths)
+        return nullptr;
+
+    env->CallVoidMethod(jFont, getGlyphWidths_mID,
+        (jint)(pageNumber * PAGE_SIZE), (jint)PAGE_SIZE, (jobject)jWidths);
+    if (WTF::CheckAndClearException(env))
+        return nullptr;
+
+    return m_widthPages.add(pageNumber, WTFMove(page)).iterator->value.get();
+}
+
+float GlyphMetricsCacheJava::widthForGlyph(RQRef& jFont, Glyph glyph)
+{
+    unsigned glyphCode = static_cast<unsigned>(glyph);
+    const WidthPage* page = widthPage(jFont, glyphCode / PAGE_SIZE);
+    return page ? (*page)[glyphCode % PAGE_SIZE] : 0.0f;
+}
+
+FloatRect GlyphMetricsCacheJava::boundsForGlyph(RQRef& jFont, Glyph glyph)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID getGlyphBoundingBox_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphBoundingBox", "(ILjava/nio/ByteBuffer;)V");
+    ASSERT(getGlyphBoundingBox_mID);
+
+    if (!m_jBoundsBuffer) {
+        m_jBoundsBuffer = JLObject(env->NewDirectByteBuffer(m_bounds.data(), sizeof(m_bounds)));
+        WTF::CheckAndClearException(env); // OOME
+        if (!m_jBoundsBuffer)
+            return { };
+    }
+
+    m_bounds.fill(0);
+    env->CallVoidMethod(jFont, getGlyphBoundingBox_mID, (jint)glyph, (jobject)m_jBoundsBuffer);
+    if (WTF::CheckAndClearException(env))
+        return { };
+
+    return FloatRect { m_bounds[0], m_bounds[1], m_bounds[2], m_bounds[3] };
+}
+
+} // namespace WebCore
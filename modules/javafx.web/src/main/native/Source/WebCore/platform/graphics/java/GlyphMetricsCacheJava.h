@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "FloatRect.h"
+#include "Glyph.h"
+#include "RQRef.h"
+
+#include <array>
+#include <wtf/HashMap.h>
+#include <wtf/Ref.h>
+#include <wtf/RefCounted.h>
+
+namespace WebCore {
+
+/*
+ * Native cache of the glyph metrics of a java font. Advances are requested
+ * from java for a whole page of glyphs at once, so that laying out a text
+ * does not cost a JNI call per glyph.
+ */
+class GlyphMetricsCacheJava : public RefCounted<GlyphMetricsCacheJava> {
+public:
+    static const unsigned PAGE_SIZE = 256;
+
+    static Ref<GlyphMetricsCacheJava> create()
+    {
+        return adoptRef(*new GlyphMetricsCacheJava());
+    }
+
+    float widthForGlyph(RQRef& jFont, Glyph);
+    FloatRect boundsForGlyph(RQRef& jFont, Glyph);
+
+private:
+    GlyphMetricsCacheJava() = default;
+
+    typedef std::array<float, PAGE_SIZE> WidthPage;
+
+    const WidthPage* widthPage(RQRef& jFont, unsigned pageNumber);
+
+    // Pages are keyed sparsely since the glyph codes of a composite font
+    // carry the slot of the physical font in the high bits.
+    HashMap<unsigned, std::unique_ptr<WidthPage>, IntHash<unsigned>, WTF::UnsignedWithZeroKeyHashTraits<unsigned>> m_widthPages;
+
+    // Bounds are not fetched by pages since they are rarely needed, but
+    // they are passed through a single direct buffer instead of a new array.
+    std::array<jfloat, 4> m_bounds;
+    JGObject m_jBoundsBuffer;
+};
+
+} // namespace WebCore
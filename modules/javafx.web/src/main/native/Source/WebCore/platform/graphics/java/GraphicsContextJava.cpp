@@ -93,6 +93,13 @@ static void setGradient(Gradient &gradient,
     p0 = gradientSpaceTransformation.mapPoint(p0);
     p1 = gradientSpaceTransformation.mapPoint(p1);
 
+    // The gradient replaces the paint the decoder could have been holding.
+    if (id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT) {
+        context->rq().resetFillState();
+    } else {
+        context->rq().resetStrokeState();
+    }
+
     context->rq().freeSpace(4 * 11 + 20 * nStops)
     << id
     << (jfloat)p0.x()
@@ -163,6 +170,7 @@ void GraphicsContextJava::savePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->rq().resetState();
 }
 
 void GraphicsContextJava::restore() {
@@ -177,6 +185,7 @@ void GraphicsContextJava::restorePlatformState()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->rq().resetState();
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -498,9 +507,12 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
     if (paintingDisabled())
         return;
 
+    RenderingQueue& rq = platformContext()->rq().freeSpace(20);
+    if (rq.elideFillColor(color))
+        return;
+
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
+    rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
     << r << g << b << a;
 }
 
@@ -523,8 +535,11 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
+    RenderingQueue& rq = platformContext()->rq().freeSpace(8);
+    if (rq.elideStrokeStyle((jint)style))
+        return;
+
+    rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
     << (jint)style;
 }
 
@@ -533,9 +548,12 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
     if (paintingDisabled())
         return;
 
+    RenderingQueue& rq = platformContext()->rq().freeSpace(20);
+    if (rq.elideStrokeColor(color))
+        return;
+
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
+    rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
     << r << g << b << a;
 }
 
@@ -544,8 +562,11 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
+    RenderingQueue& rq = platformContext()->rq().freeSpace(8);
+    if (rq.elideStrokeThickness(strokeThickness))
+        return;
+
+    rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
     << strokeThickness;
 }
 
@@ -626,6 +647,7 @@ void GraphicsContextJava::endTransparencyLayer()
 
     platformContext()->rq().freeSpace(4)
     << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    platformContext()->rq().resetState();
 
     GraphicsContext::endTransparencyLayer();
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -107,17 +107,17 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
     static jmethodID midAddImageData = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "addImageData",
-        "([B)V");
+        "(Ljava/nio/ByteBuffer;)V");
     ASSERT(midAddImageData);
 
+    // Hand each segment of the shared buffer to the decoder in place; the
+    // direct buffer is only valid for the duration of the call.
     while (m_receivedDataSize < data.size()) {
         const auto& someData = data.getSomeData(m_receivedDataSize);
         unsigned length = someData.size();
-        JLByteArray jArray(env->NewByteArray(length));
-        if (jArray && !WTF::CheckAndClearException(env)) {
-            // not OOME in Java
-            env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.data());
-            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
+        JLObject jBuffer(env->NewDirectByteBuffer(const_cast<uint8_t*>(someData.data()), length));
+        if (jBuffer && !WTF::CheckAndClearException(env)) {
+            env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jobject)jBuffer);
             WTF::CheckAndClearException(env);
         }
         m_receivedDataSize += length;
@@ -176,8 +176,10 @@ size_t ImageDecoderJava::frameCount() const
         : count;
 }
 
-PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
+PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel subsamplingLevel, const DecodingOptions&)
 {
+    // May be called on the ImageSource decoding queue for DecodingMode::Asynchronous;
+    // WorkQueue attaches its threads to the JVM.
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -186,13 +188,14 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
     static jmethodID midGetFrame = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "getFrame",
-        "(I)Lcom/sun/webkit/graphics/WCImageFrame;");
+        "(II)Lcom/sun/webkit/graphics/WCImageFrame;");
     ASSERT(midGetFrame);
 
     JLObject frame(env->CallObjectMethod(
         m_nativeDecoder,
         midGetFrame,
-        idx));
+        (jint)idx,
+        (jint)subsamplingLevel));
     WTF::CheckAndClearException(env);
 
     if(!frame)
@@ -248,21 +251,24 @@ IntSize ImageDecoderJava::size() const
     return m_size;
 }
 
-IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
+IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel subsamplingLevel) const
 {
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
     }
+    // The decoder reports the size of the frame that getFrame(int, int)
+    // returns, which is the full size when it cannot subsample.
     static jmethodID midGetFrameSize = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "getFrameSize",
-        "(I)[I");
+        "(II)[I");
     ASSERT(midGetFrameSize);
     JLocalRef<jintArray> jsize((jintArray)env->CallObjectMethod(
                         m_nativeDecoder,
                         midGetFrameSize,
-                        idx));
+                        (jint)idx,
+                        (jint)subsamplingLevel));
     if (!jsize) {
         return m_size;
     }
@@ -276,7 +282,6 @@ IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
 
 bool ImageDecoderJava::frameAllowSubsamplingAtIndex(size_t) const
 {
-    notImplemented();
     return true;
 }
 
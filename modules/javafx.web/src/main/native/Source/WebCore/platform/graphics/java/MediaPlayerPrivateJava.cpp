@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -303,6 +303,7 @@ void MediaPlayerPrivate::load(const String& url)
     if (m_networkState == MediaPlayer::NetworkState::Loading) {
         cancelLoad();
     }
+    m_timeAnchor = std::nullopt;
 
     String userAgent;
     // MediaPlayerClient mpClient = m_player->client();
@@ -326,6 +327,7 @@ void MediaPlayerPrivate::cancelLoad()
 {
     m_paused = true;
     m_seeking = false;
+    m_timeAnchor = std::nullopt;
 
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID s_mID
@@ -430,6 +432,9 @@ float MediaPlayerPrivate::currentTime() const
         return m_seekTime;
     }
 
+    if (m_timeAnchor)
+        return extrapolatedTime(*m_timeAnchor);
+
     JNIEnv* env = WTF::GetJavaEnv();
     // in case of error Unsupported protocol Data in JavaMediaPlayer
     // The Native MediaElement is getting garbage collected in javascript core, hence calling
@@ -448,11 +453,27 @@ float MediaPlayerPrivate::currentTime() const
     return (float)result;
 }
 
+float MediaPlayerPrivate::extrapolatedTime(const TimeAnchor& anchor) const
+{
+    if (m_paused || !anchor.rate)
+        return anchor.time;
+
+    float time = anchor.time + anchor.rate * (MonotonicTime::now() - anchor.wallTime).seconds();
+    if (time < 0)
+        return 0;
+    // The duration is 0 until it's known, and infinite for live streams.
+    if (m_duration > 0 && time > m_duration)
+        return m_duration;
+    return time;
+}
+
 void MediaPlayerPrivate::seek(float time)
 {
     PLOG_TRACE1(">>MediaPlayerPrivate::seek(%f)\n", time);
 
     m_seekTime = time;
+    if (m_timeAnchor)
+        m_timeAnchor = TimeAnchor { time, m_timeAnchor->rate, MonotonicTime::now() };
 
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID s_mID
@@ -478,6 +499,11 @@ MediaTime MediaPlayerPrivate::startTime() const
 
 void MediaPlayerPrivate::setRate(float rate)
 {
+    if (m_timeAnchor && !m_seeking) {
+        // Rebase the anchor so that the position doesn't jump.
+        m_timeAnchor = TimeAnchor { extrapolatedTime(*m_timeAnchor), rate, MonotonicTime::now() };
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
     static jmethodID s_mID
         = env->GetMethodID(PG_GetMediaPlayerClass(env), "fwkSetRate", "(F)V");
@@ -789,6 +815,11 @@ void MediaPlayerPrivate::notifyBufferChanged(std::unique_ptr<PlatformTimeRanges>
     m_didLoadingProgress = true;
 }
 
+void MediaPlayerPrivate::notifyCurrentTime(float time, float rate, Seconds age)
+{
+    m_timeAnchor = TimeAnchor { time, rate, MonotonicTime::now() - age };
+}
+
 
 // *********************************************************
 // JNI functions
@@ -883,6 +914,13 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCMediaPlayer_notifyBufferCh
     player->notifyBufferChanged(std::unique_ptr<PlatformTimeRanges>(timeRanges), bytesLoaded);
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCMediaPlayer_notifyCurrentTime
+    (JNIEnv*, jobject, jlong ptr, jfloat time, jfloat rate, jlong ageNanos)
+{
+    MediaPlayerPrivate* player = MediaPlayerPrivate::getPlayer(ptr);
+    player->notifyCurrentTime(time, rate, Seconds::fromNanoseconds(ageNanos));
+}
+
 } // extern "C"
 
 } // namespace WebCore
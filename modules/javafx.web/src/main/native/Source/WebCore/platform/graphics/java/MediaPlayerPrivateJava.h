@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include "MediaPlayerPrivate.h"
 #include <jni.h>
 #include "TimeRanges.h"
+#include <wtf/MonotonicTime.h>
 
 namespace WebCore {
     extern void resetErrorCodeInMediaPlayer(unsigned int err);
@@ -148,6 +149,7 @@ namespace WebCore {
         void notifySizeChanged(int width, int height);
         void notifyNewFrame();
         void notifyBufferChanged(std::unique_ptr<PlatformTimeRanges> timeRanges, int bytesLoaded);
+        void notifyCurrentTime(float time, float rate, Seconds age);
 
     private:
         MediaPlayer* m_player;
@@ -169,6 +171,18 @@ namespace WebCore {
 
         RefPtr<RQRef> m_jPlayer;
 
+        // The playback position last reported by the Java player. While
+        // playing, the position advances from it at the given rate, so that
+        // currentTime() doesn't need to call into Java.
+        struct TimeAnchor {
+            float time { 0 };
+            float rate { 0 };
+            MonotonicTime wallTime;
+        };
+        std::optional<TimeAnchor> m_timeAnchor;
+
+        float extrapolatedTime(const TimeAnchor&) const;
+
         void setNetworkState(MediaPlayer::NetworkState networkState);
         void setReadyState(MediaPlayer::ReadyState readyState);
     };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,9 +36,11 @@
 #include "ImageBuffer.h"
 #include "PathStream.h"
 
+#include <wtf/StdLibExtras.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/java/JavaRef.h>
 
+#include "com_sun_webkit_graphics_WCPath.h"
 #include "com_sun_webkit_graphics_WCPathIterator.h"
 
 namespace WebCore {
@@ -98,35 +100,269 @@ RefPtr<RQRef> copyPath(RefPtr<RQRef> p)
     return RQRef::create(ref);
 }
 
-UniqueRef<PathJava> PathJava::create(RefPtr<RQRef>&& platformPath, std::unique_ptr<PathStream>&& elementsStream)
+// Packs the segments the way WCPath.addSegments() reads them: an int type
+// followed by its float arguments.
+static Vector<uint32_t> packSegments(const PathImpl& path)
+{
+    Vector<uint32_t> words;
+
+    auto putType = [&](jint type) {
+        words.append(type);
+    };
+    auto putFloat = [&](float value) {
+        words.append(bitwise_cast<uint32_t>(value));
+    };
+    auto putPoint = [&](const FloatPoint& point) {
+        putFloat(point.x());
+        putFloat(point.y());
+    };
+    auto putArcTo = [&](const FloatPoint& point1, const FloatPoint& point2, float radius) {
+        putType(com_sun_webkit_graphics_WCPath_SEG_ARCTO);
+        putPoint(point1);
+        putPoint(point2);
+        putFloat(radius);
+    };
+
+    path.applySegments([&](const PathSegment& segment) {
+        WTF::switchOn(segment.data(),
+            [&](const PathArcTo& data) {
+                putArcTo(data.controlPoint1, data.controlPoint2, data.radius);
+            },
+            [&](const PathDataArc& data) {
+                putType(com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO);
+                putPoint(data.start);
+                putArcTo(data.controlPoint1, data.controlPoint2, data.radius);
+            },
+            [&](const PathArc& data) {
+                putType(com_sun_webkit_graphics_WCPath_SEG_ARC);
+                putPoint(data.center);
+                putFloat(data.radius);
+                putFloat(data.startAngle);
+                putFloat(data.endAngle);
+                words.append(data.direction == RotationDirection::Counterclockwise ? 1 : 0);
+            },
+            [&](const PathEllipseInRect& data) {
+                putType(com_sun_webkit_graphics_WCPath_SEG_ELLIPSE);
+                putPoint(data.rect.location());
+                putFloat(data.rect.width());
+                putFloat(data.rect.height());
+            },
+            [&](const auto&) {
+                bool applied = segment.applyElements([&](const PathElement& element) {
+                    switch (element.type) {
+                    case PathElement::Type::MoveToPoint:
+                        putType(com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO);
+                        putPoint(element.points[0]);
+                        break;
+                    case PathElement::Type::AddLineToPoint:
+                        putType(com_sun_webkit_graphics_WCPathIterator_SEG_LINETO);
+                        putPoint(element.points[0]);
+                        break;
+                    case PathElement::Type::AddQuadCurveToPoint:
+                        putType(com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO);
+                        putPoint(element.points[0]);
+                        putPoint(element.points[1]);
+                        break;
+                    case PathElement::Type::AddCurveToPoint:
+                        putType(com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO);
+                        putPoint(element.points[0]);
+                        putPoint(element.points[1]);
+                        putPoint(element.points[2]);
+                        break;
+                    case PathElement::Type::CloseSubpath:
+                        putType(com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE);
+                        break;
+                    }
+                });
+                // Rects, rounded rects and ellipses are never stored, see PathJava::addRect().
+                ASSERT_UNUSED(applied, applied);
+            });
+    });
+
+    return words;
+}
+
+static RefPtr<RQRef> createPlatformPath(const PathImpl& path)
 {
-    return makeUniqueRef<PathJava>(WTFMove(platformPath), WTFMove(elementsStream));
+    Vector<uint32_t> segments = packSegments(path);
+    if (segments.isEmpty())
+        return createEmptyPath();
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetGraphicsManagerClass(env),
+        "fwkCreateWCPath",
+        "(Ljava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/WCPath;");
+    ASSERT(mid);
+
+    JLObject buffer(env->NewDirectByteBuffer(segments.data(), segments.size() * sizeof(uint32_t)));
+    JLObject ref(env->CallObjectMethod(PL_GetGraphicsManager(env), mid, (jobject)buffer));
+    ASSERT(ref);
+    WTF::CheckAndClearException(env);
+
+    return RQRef::create(ref);
 }
 
-PathJava::PathJava()
-    : m_platformPath(createEmptyPath())
-    , m_elementsStream(PathStream::create().moveToUniquePtr())
+// Reads back the segments of a java path, which only consist of lines and curves.
+static std::optional<UniqueRef<PathStream>> readPlatformPath(RQRef& platformPath)
 {
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
+        "getSegments", "()Ljava/nio/ByteBuffer;");
+    ASSERT(mid);
+
+    JLObject buffer(env->CallObjectMethod(platformPath, mid));
+    if (WTF::CheckAndClearException(env) || !buffer)
+        return std::nullopt;
+
+    auto* words = static_cast<const uint32_t*>(env->GetDirectBufferAddress(buffer));
+    size_t size = env->GetDirectBufferCapacity(buffer) / sizeof(uint32_t);
+    size_t index = 0;
+
+    auto point = [&] {
+        FloatPoint result(bitwise_cast<float>(words[index]), bitwise_cast<float>(words[index + 1]));
+        index += 2;
+        return result;
+    };
+
+    auto stream = PathStream::create();
+    while (index < size) {
+        switch (words[index++]) {
+        case com_sun_webkit_graphics_WCPathIterator_SEG_MOVETO:
+            stream->moveTo(point());
+            break;
+        case com_sun_webkit_graphics_WCPathIterator_SEG_LINETO:
+            stream->addLineTo(point());
+            break;
+        case com_sun_webkit_graphics_WCPathIterator_SEG_QUADTO: {
+            auto controlPoint = point();
+            stream->addQuadCurveTo(controlPoint, point());
+            break;
+        }
+        case com_sun_webkit_graphics_WCPathIterator_SEG_CUBICTO: {
+            auto controlPoint1 = point();
+            auto controlPoint2 = point();
+            stream->addBezierCurveTo(controlPoint1, controlPoint2, point());
+            break;
+        }
+        case com_sun_webkit_graphics_WCPathIterator_SEG_CLOSE:
+            stream->closeSubpath();
+            break;
+        default:
+            ASSERT_NOT_REACHED();
+            return std::nullopt;
+        }
+    }
+    ASSERT(index == size);
+
+    return stream;
 }
 
-PathJava::PathJava(RefPtr<RQRef>&& platformPath, std::unique_ptr<PathStream>&& elementsStream)
-    : m_platformPath(WTFMove(platformPath))
-    , m_elementsStream(WTFMove(elementsStream))
+// Number of line segments a curve is flattened into for hit testing. It
+// keeps the distance between the curve and its chords well below a pixel.
+static unsigned flatteningSteps(const FloatPoint& start, std::initializer_list<FloatPoint> points)
 {
-    ASSERT(m_platformPath);
+    float length = 0;
+    FloatPoint previous = start;
+    for (auto& point : points) {
+        length += (point - previous).diagonalLength();
+        previous = point;
+    }
+    return clampTo<unsigned>(std::ceil(std::sqrt(length)), 1u, 100u);
+}
+
+// Returns the winding number of the path around the point, treating every
+// subpath as closed, or std::nullopt if the path contains arcs.
+static std::optional<int> windingNumber(const PathImpl& path, const FloatPoint& point)
+{
+    int winding = 0;
+    FloatPoint subpathStart;
+    FloatPoint current;
+
+    auto addEdge = [&](const FloatPoint& from, const FloatPoint& to) {
+        float side = (to.x() - from.x()) * (point.y() - from.y()) - (point.x() - from.x()) * (to.y() - from.y());
+        if (from.y() <= point.y()) {
+            if (to.y() > point.y() && side > 0)
+                ++winding;
+        } else if (to.y() <= point.y() && side < 0)
+            --winding;
+    };
+    auto lineTo = [&](const FloatPoint& to) {
+        addEdge(current, to);
+        current = to;
+    };
+
+    bool applied = path.applyElements([&](const PathElement& element) {
+        switch (element.type) {
+        case PathElement::Type::MoveToPoint:
+            addEdge(current, subpathStart);
+            subpathStart = current = element.points[0];
+            break;
+        case PathElement::Type::AddLineToPoint:
+            lineTo(element.points[0]);
+            break;
+        case PathElement::Type::AddQuadCurveToPoint: {
+            FloatPoint p0 = current;
+            const auto& p1 = element.points[0];
+            const auto& p2 = element.points[1];
+            unsigned steps = flatteningSteps(p0, { p1, p2 });
+            for (unsigned i = 1; i <= steps; ++i) {
+                float t = float(i) / steps;
+                float mt = 1 - t;
+                lineTo(FloatPoint(
+                    mt * mt * p0.x() + 2 * mt * t * p1.x() + t * t * p2.x(),
+                    mt * mt * p0.y() + 2 * mt * t * p1.y() + t * t * p2.y()));
+            }
+            break;
+        }
+        case PathElement::Type::AddCurveToPoint: {
+            FloatPoint p0 = current;
+            const auto& p1 = element.points[0];
+            const auto& p2 = element.points[1];
+            const auto& p3 = element.points[2];
+            unsigned steps = flatteningSteps(p0, { p1, p2, p3 });
+            for (unsigned i = 1; i <= steps; ++i) {
+                float t = float(i) / steps;
+                float mt = 1 - t;
+                lineTo(FloatPoint(
+                    mt * mt * mt * p0.x() + 3 * mt * mt * t * p1.x() + 3 * mt * t * t * p2.x() + t * t * t * p3.x(),
+                    mt * mt * mt * p0.y() + 3 * mt * mt * t * p1.y() + 3 * mt * t * t * p2.y() + t * t * t * p3.y()));
+            }
+            break;
+        }
+        case PathElement::Type::CloseSubpath:
+            lineTo(subpathStart);
+            break;
+        }
+    });
+    if (!applied)
+        return std::nullopt;
+
+    addEdge(current, subpathStart);
+    return winding;
 }
 
-UniqueRef<PathImpl> PathJava::clone() const
+PathJava::PathJava()
+    : m_elementsStream(PathStream::create())
 {
-    RefPtr<RQRef> platformPathCopy(copyPath(platformPath()));
+}
 
-    auto elementsStream = m_elementsStream ? m_elementsStream->clone().moveToUniquePtr() : nullptr;
+PathJava::PathJava(const PathJava& other)
+    : m_elementsStream(other.m_elementsStream->clone())
+    , m_platformPath(other.m_platformPath)
+{
+}
 
-    return PathJava::create(WTFMove(platformPathCopy), std::unique_ptr<PathStream> { downcast<PathStream>(elementsStream.release()) });
+UniqueRef<PathImpl> PathJava::clone() const
+{
+    return makeUniqueRef<PathJava>(*this);
 }
 
 PlatformPathPtr PathJava::platformPath() const
 {
+    if (!m_platformPath)
+        m_platformPath = createPlatformPath(m_elementsStream.get());
     return m_platformPath.get();
 }
 
@@ -134,109 +370,43 @@ bool PathJava::operator==(const PathImpl& other) const
 {
     if (!is<PathJava>(other))
         return false;
-    return m_platformPath == downcast<PathJava>(other).m_platformPath;
+    return *m_elementsStream == *downcast<PathJava>(other).m_elementsStream;
 }
 
 void PathJava::moveTo(const FloatPoint& p)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->moveTo(p);
+    m_platformPath = nullptr;
 }
 
 void PathJava::addLineTo(const FloatPoint& p)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->addLineTo(p);
+    m_platformPath = nullptr;
 }
 
 void PathJava::addQuadCurveTo(const FloatPoint& cp, const FloatPoint& p)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)cp.x(), (jdouble)cp.y(), (jdouble)p.x(), (jdouble)p.y());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->addQuadCurveTo(cp, p);
+    m_platformPath = nullptr;
 }
 
 void PathJava::addBezierCurveTo(const FloatPoint& controlPoint1, const FloatPoint& controlPoint2, const FloatPoint& endPoint)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)controlPoint1.x(), (jdouble)controlPoint1.y(),
-                        (jdouble)controlPoint2.x(), (jdouble)controlPoint2.y(),
-                        (jdouble)endPoint.x(), (jdouble)endPoint.y());
-    WTF::CheckAndClearException(env);
-}
-
-static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
-{
-    return p1.x() * (p2.y() - p3.y()) + p2.x() * (p3.y() - p1.y()) + p3.x() * (p1.y() - p2.y());
+    m_elementsStream->addBezierCurveTo(controlPoint1, controlPoint2, endPoint);
+    m_platformPath = nullptr;
 }
 
 void PathJava::addArcTo(const FloatPoint& p1, const FloatPoint& p2, float radius)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)p1.x(), (jdouble)p1.y(),
-                        (jdouble)p2.x(), (jdouble)p2.y(), (jdouble)radius);
-    WTF::CheckAndClearException(env);
+    m_elementsStream->addArcTo(p1, p2, radius);
+    m_platformPath = nullptr;
 }
 
 void PathJava::addArc(const FloatPoint& p, float radius, float startAngle, float endAngle, RotationDirection direction)
 {
-    ASSERT(m_platformPath);
-    bool clockwise = false;
-    if (direction == RotationDirection::Counterclockwise) {
-        clockwise = true;
-    } else if (direction == RotationDirection::Clockwise) {
-        clockwise = false;
-    }
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)p.x(), (jdouble)p.y(),
-        (jdouble)radius, (jdouble)startAngle, (jdouble)endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    m_elementsStream->addArc(p, radius, startAngle, endAngle, direction);
+    m_platformPath = nullptr;
 }
 
 void PathJava::addEllipse(const FloatPoint& point, float radiusX, float radiusY, float rotation, float startAngle, float endAngle, RotationDirection direction)
@@ -246,32 +416,19 @@ void PathJava::addEllipse(const FloatPoint& point, float radiusX, float radiusY,
 
 void PathJava::addEllipseInRect(const FloatRect& r)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)r.x(), (jdouble)r.y(),
-                        (jdouble)r.width(), (jdouble)r.height());
-    WTF::CheckAndClearException(env);
+    m_elementsStream->addEllipseInRect(r);
+    m_platformPath = nullptr;
 }
 
 void PathJava::addRect(const FloatRect& r)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)r.x(), (jdouble)r.y(),
-                              (jdouble)r.width(), (jdouble)r.height());
-    WTF::CheckAndClearException(env);
+    // Stored as lines so that the stream can still be transformed and
+    // hit tested natively.
+    moveTo(r.location());
+    addLineTo(FloatPoint(r.maxX(), r.y()));
+    addLineTo(r.maxXMaxYCorner());
+    addLineTo(FloatPoint(r.x(), r.maxY()));
+    closeSubpath();
 }
 
 void PathJava::addRoundedRect(const FloatRoundedRect& roundedRect, PathRoundedRect::Strategy)
@@ -281,82 +438,51 @@ void PathJava::addRoundedRect(const FloatRoundedRect& roundedRect, PathRoundedRe
 
 void PathJava::closeSubpath()
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    m_elementsStream->closeSubpath();
+    m_platformPath = nullptr;
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
 {
-    notImplemented();
+    PathJava transformedPath(path);
+    if (!transformedPath.transform(transform))
+        return;
+
+    transformedPath.m_elementsStream->applySegments([&](const PathSegment& segment) {
+        appendSegment(segment);
+    });
 }
 
 void PathJava::applySegments(const PathSegmentApplier& applier) const
 {
-    applyElements([&](const PathElement& pathElement) {
-        switch (pathElement.type) {
-        case PathElement::Type::MoveToPoint:
-            applier({ PathMoveTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddLineToPoint:
-            applier({ PathLineTo { pathElement.points[0] } });
-            break;
-
-        case PathElement::Type::AddQuadCurveToPoint:
-            applier({ PathQuadCurveTo { pathElement.points[0], pathElement.points[1] } });
-            break;
-
-        case PathElement::Type::AddCurveToPoint:
-            applier({ PathBezierCurveTo { pathElement.points[0], pathElement.points[1], pathElement.points[2] } });
-            break;
-
-        case PathElement::Type::CloseSubpath:
-            applier({ PathCloseSubpath { } });
-            break;
-        }
-    });
+    m_elementsStream->applySegments(applier);
 }
 
 bool PathJava::applyElements(const PathElementApplier& applier) const
 {
-    // need to implement this method after looking into cairo implementation
-    return true;
+    return m_elementsStream->applyElements(applier);
 }
 
 bool PathJava::isEmpty() const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-                                            "isEmpty", "()Z");
-    ASSERT(mid);
-
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
-
-    return jbool_to_bool(res);
+    return m_elementsStream->isEmpty();
 }
 
 FloatPoint PathJava::currentPoint() const
 {
-    //utatodo: return current point of subpath.
-    float quietNaN = std::numeric_limits<float>::quiet_NaN();
-    return FloatPoint(quietNaN, quietNaN);
+    return m_elementsStream->currentPoint();
 }
 
 bool PathJava::transform(const AffineTransform& transform)
 {
-    ASSERT(m_platformPath);
+    if (m_elementsStream->transform(transform)) {
+        m_platformPath = nullptr;
+        return true;
+    }
+
+    // Arcs have to be flattened before they can be transformed. Let a java
+    // copy of the path do both and take its segments back.
+    RefPtr<RQRef> transformedPath = copyPath(platformPath());
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -364,11 +490,18 @@ bool PathJava::transform(const AffineTransform& transform)
         "transform", "(DDDDDD)V");
     ASSERT(mid);
 
-    env->CallVoidMethod(*m_platformPath, mid,
+    env->CallVoidMethod(*transformedPath, mid,
                         (jdouble)transform.a(), (jdouble)transform.b(),
                         (jdouble)transform.c(), (jdouble)transform.d(),
                         (jdouble)transform.e(), (jdouble)transform.f());
     WTF::CheckAndClearException(env);
+
+    auto stream = readPlatformPath(*transformedPath);
+    if (!stream)
+        return false;
+
+    m_elementsStream = WTFMove(*stream);
+    m_platformPath = WTFMove(transformedPath);
     return true;
 }
 
@@ -377,7 +510,8 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
     if (isEmpty() || !std::isfinite(point.x()) || !std::isfinite(point.y()))
         return false;
 
-    ASSERT(m_platformPath);
+    if (auto winding = windingNumber(m_elementsStream.get(), point))
+        return rule == WindRule::EvenOdd ? *winding % 2 : *winding;
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -385,7 +519,7 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
         "(IDD)Z");
     ASSERT(mid);
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jint)rule,
+    jboolean res = env->CallBooleanMethod(*platformPath(), mid, (jint)rule,
         (jdouble)point.x(), (jdouble)point.y());
     WTF::CheckAndClearException(env);
 
@@ -394,7 +528,6 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
 
 bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
     ASSERT(strokeStyleApplier);
 
     GraphicsContext& gc = scratchContext();
@@ -426,7 +559,7 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
     JLocalRef<jdoubleArray> dashArray(env->NewDoubleArray(size));
     env->SetDoubleArrayRegion(dashArray, 0, size, dashes.data());
 
-    jboolean res = env->CallBooleanMethod(*m_platformPath, mid, (jdouble)p.x(),
+    jboolean res = env->CallBooleanMethod(*platformPath(), mid, (jdouble)p.x(),
         (jdouble)p.y(), (jdouble) thickness, (jdouble) miterLimit,
         (jint) cap, (jint) join, (jdouble) dashOffset, (jdoubleArray) dashArray);
 
@@ -437,56 +570,26 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 
 FloatRect PathJava::fastBoundingRect() const
 {
-    return boundingRect();
+    return m_elementsStream->fastBoundingRect();
 }
 
 FloatRect PathJava::boundingRect() const
 {
-    return strokeBoundingRect(nullptr);
+    return m_elementsStream->boundingRect();
 }
 
 FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "getBounds",
-            "()Lcom/sun/webkit/graphics/WCRectangle;");
-    ASSERT(mid);
-
-    JLObject rect(env->CallObjectMethod(*m_platformPath, mid));
-    WTF::CheckAndClearException(env);
-    if (rect) {
-        static jfieldID rectxFID = env->GetFieldID(PG_GetRectangleClass(env), "x", "F");
-        ASSERT(rectxFID);
-        static jfieldID rectyFID = env->GetFieldID(PG_GetRectangleClass(env), "y", "F");
-        ASSERT(rectyFID);
-        static jfieldID rectwFID = env->GetFieldID(PG_GetRectangleClass(env), "w", "F");
-        ASSERT(rectwFID);
-        static jfieldID recthFID = env->GetFieldID(PG_GetRectangleClass(env), "h", "F");
-        ASSERT(recthFID);
-
-        FloatRect bounds(
-            float(env->GetFloatField(rect, rectxFID)),
-            float(env->GetFloatField(rect, rectyFID)),
-            float(env->GetFloatField(rect, rectwFID)),
-            float(env->GetFloatField(rect, recthFID)));
-        WTF::CheckAndClearException(env);
-
-        float thickness;
-        if (strokeStyleApplier) {
-            GraphicsContext& gc = scratchContext();
-            gc.save();
-            strokeStyleApplier(gc);
-            thickness = gc.strokeThickness();
-            gc.restore();
-            bounds.inflate(thickness / 2);
-        }
-        return bounds;
-    } else {
-        return FloatRect();
+    FloatRect bounds = boundingRect();
+    if (strokeStyleApplier) {
+        GraphicsContext& gc = scratchContext();
+        gc.save();
+        strokeStyleApplier(gc);
+        float thickness = gc.strokeThickness();
+        gc.restore();
+        bounds.inflate(thickness / 2);
     }
+    return bounds;
 }
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,10 +40,9 @@ class PathJava final : public PathImpl {
 public:
     static UniqueRef<PathJava> create();
     static UniqueRef<PathJava> create(const PathStream&);
-    static UniqueRef<PathJava> create(RefPtr<RQRef>&&, std::unique_ptr<PathStream>&& = nullptr);
 
     PathJava();
-    PathJava(RefPtr<RQRef>&&, std::unique_ptr<PathStream>&&);
+    PathJava(const PathJava&);
 
     PlatformPathPtr platformPath() const;
 
@@ -87,8 +86,11 @@ private:
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
 
-    RefPtr<RQRef> m_platformPath;
-    std::unique_ptr<PathStream> m_elementsStream;
+    // The segments are only kept in m_elementsStream, which is always a
+    // PathStream. The java path is created from them in a single call the
+    // first time it is needed and dropped again whenever the path changes.
+    UniqueRef<PathImpl> m_elementsStream;
+    mutable RefPtr<RQRef> m_platformPath;
 };
 
 } // namespace WebCore
@@ -40,7 +40,7 @@ namespace WebCore {
         WTF_MAKE_NONCOPYABLE(PlatformContextJava);
     public:
         PlatformContextJava(const JLObject& jRQ, RefPtr<RQRef> jTheme, bool autoFlush = false)
-            : m_rq(RenderingQueue::create(jRQ, com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT, autoFlush))
+            : m_rq(RenderingQueue::create(jRQ, RenderingQueue::BUFFER_CAPACITY, autoFlush))
             , m_jRenderTheme(jTheme)
         {}
 
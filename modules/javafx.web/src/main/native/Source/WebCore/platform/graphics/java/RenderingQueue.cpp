@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -45,6 +45,43 @@ static Addr2ByteBuffer& getAddr2ByteBuffer()
     return container.get();
 }
 
+/*
+ * Buffers released by java are kept for reuse, so that a flush does not
+ * need to allocate neither the native memory nor the NIO wrapper.
+ * The pool is shared by all queues since the page creates a new queue
+ * for every paint. Accessed on the Event thread only, see [flushBuffer]
+ * and [twkRelease].
+ */
+typedef Vector<RefPtr<ByteBuffer> > ByteBufferPool;
+
+static ByteBufferPool& getByteBufferPool()
+{
+    static NeverDestroyed<ByteBufferPool> pool;
+    return pool.get();
+}
+
+static RefPtr<ByteBuffer> obtainByteBuffer(int capacity)
+{
+    ByteBufferPool& pool = getByteBufferPool();
+    if (capacity == RenderingQueue::BUFFER_CAPACITY && !pool.isEmpty()) {
+        return pool.takeLast();
+    }
+    return ByteBuffer::create(capacity);
+}
+
+static void recycleByteBuffer(RefPtr<ByteBuffer> buffer)
+{
+    // Oversized buffers are allocated for a single operation, don't keep them.
+    if (buffer->capacity() != RenderingQueue::BUFFER_CAPACITY) {
+        return;
+    }
+    buffer->reset();
+    ByteBufferPool& pool = getByteBufferPool();
+    if (pool.size() < RenderingQueue::MAX_POOLED_BUFFER_COUNT) {
+        pool.append(WTFMove(buffer));
+    }
+}
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -65,8 +102,9 @@ RenderingQueue& RenderingQueue::freeSpace(int size) {
         }
     }
     if (!m_buffer) {
-        m_buffer = RefPtr<ByteBuffer>(ByteBuffer::create(std::max(m_capacity, size)));
+        m_buffer = obtainByteBuffer(std::max(m_capacity, size));
     }
+    ++m_opCount;
     return *this;
 }
 
@@ -106,7 +144,7 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;III)V");
     ASSERT(midFwkAddBuffer);
 
     Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
@@ -114,10 +152,17 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     env->CallVoidMethod(
         getWCRenderingQueue(),
         midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
+        (jobject)(m_buffer->directByteBuffer(env)),
+        (jint)m_buffer->position(),
+        (jint)m_opCount,
+        (jint)m_elidedOpCount);
     WTF::CheckAndClearException(env);
 
     m_buffer = nullptr;
+    m_opCount = 0;
+    m_elidedOpCount = 0;
+    // The next buffer may be decoded to a graphics context in any state.
+    resetState();
 
     return *this;
 }
@@ -139,7 +184,10 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
         char *key = (char *)env->GetDirectBufferAddress(
             JLObject(env->GetObjectArrayElement(bufs, i)));
         if (key != 0) {
-            a2bb.remove(key);
+            RefPtr<ByteBuffer> buffer = a2bb.take(key);
+            if (buffer) {
+                recycleByteBuffer(WTFMove(buffer));
+            }
         }
     }
 }
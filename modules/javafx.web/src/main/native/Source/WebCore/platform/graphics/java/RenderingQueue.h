@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,12 +26,15 @@
 #pragma once
 
 #include <jni.h>
+#include <optional>
 #include <wtf/Vector.h>
 #include <wtf/RefCounted.h>
 #include <wtf/HashSet.h>
 #include <wtf/java/DbgUtils.h>
 
+#include "Color.h"
 #include "RQRef.h"
+#include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
@@ -44,15 +47,30 @@ public:
         return adoptRef(new ByteBuffer(capacity));
     }
 
-    JLObject createDirectByteBuffer(JNIEnv* env) {
+    // The direct buffer spans the whole capacity and is created only once,
+    // so that a recycled ByteBuffer is passed to Java without a new NIO wrapper.
+    // The number of valid bytes is passed separately, see [position].
+    JLObject directByteBuffer(JNIEnv* env) {
         ASSERT(!isEmpty());
-        JLObject ret(env->NewDirectByteBuffer(m_buffer, m_position));
-        m_nio_holder = ret;
-        return ret;
+        if (!m_nio_holder) {
+            m_nio_holder = JLObject(env->NewDirectByteBuffer(m_buffer, m_capacity));
+        }
+        return m_nio_holder;
     }
 
     char* bufferAddress() { return m_buffer; }
 
+    int capacity() const { return m_capacity; }
+
+    int position() const { return m_position; }
+
+    // Makes the buffer ready for reuse. The references kept for
+    // the previous content are released.
+    void reset() {
+        m_refList.clear();
+        m_position = 0;
+    }
+
     void putRef(RefPtr<RQRef> ref) {
         ASSERT(m_position + sizeof(jint) <= m_capacity);
         RefPtr<RQRef> repeatable_use_holder(ref);
@@ -72,6 +90,12 @@ public:
         m_position += sizeof(jfloat);
     }
 
+    void putInts(const jint* values, unsigned count) {
+        ASSERT(m_position + count * sizeof(jint) <= m_capacity);
+        memcpy((m_buffer + m_position), values, count * sizeof(jint));
+        m_position += count * sizeof(jint);
+    }
+
     bool hasFreeSpace(int size) { return m_position + size <= m_capacity; }
 
     bool isEmpty() { return m_position == 0; }
@@ -109,6 +133,13 @@ class RenderingQueue : public RefCounted<RenderingQueue> {
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
 
+    // Capacity of the buffers written by a queue. Operations that do not
+    // fit get a buffer of their own size, which is never pooled.
+    static const int BUFFER_CAPACITY = com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / MAX_BUFFER_COUNT;
+
+    // Maximum number of released buffers kept for reuse by all queues.
+    static const size_t MAX_POOLED_BUFFER_COUNT = 32;
+
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
         int capacity,
@@ -116,6 +147,37 @@ public:
 
     int capacity() { return m_capacity; }
 
+    // Redundant state changes are not written to the queue as long as
+    // the decoder is known to hold the same value. The tracked state is
+    // dropped whenever the decoder state may diverge (the state stack,
+    // transparency layers, gradients, a new buffer).
+    bool elideFillColor(const Color& color) {
+        return elideStateChange(m_lastFillColor, color);
+    }
+
+    bool elideStrokeColor(const Color& color) {
+        return elideStateChange(m_lastStrokeColor, color);
+    }
+
+    bool elideStrokeStyle(jint style) {
+        return elideStateChange(m_lastStrokeStyle, style);
+    }
+
+    bool elideStrokeThickness(jfloat thickness) {
+        return elideStateChange(m_lastStrokeThickness, thickness);
+    }
+
+    void resetFillState() { m_lastFillColor = std::nullopt; }
+
+    void resetStrokeState() { m_lastStrokeColor = std::nullopt; }
+
+    void resetState() {
+        m_lastFillColor = std::nullopt;
+        m_lastStrokeColor = std::nullopt;
+        m_lastStrokeStyle = std::nullopt;
+        m_lastStrokeThickness = std::nullopt;
+    }
+
     RenderingQueue& operator << (RefPtr<RQRef> r) {
         m_buffer->putRef(r);
         return *this;
@@ -131,6 +193,12 @@ public:
         return *this;
     }
 
+    // Writes an array inline; the space has to be reserved by [freeSpace].
+    RenderingQueue& putInts(const jint* values, unsigned count) {
+        m_buffer->putInts(values, count);
+        return *this;
+    }
+
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
@@ -163,6 +231,18 @@ private:
     void flush();
     void disposeGraphics();
 
+    template<typename T>
+    bool elideStateChange(std::optional<T>& last, const T& value) {
+        if (last && *last == value) {
+            // The space reserved by [freeSpace] is left unused.
+            --m_opCount;
+            ++m_elidedOpCount;
+            return true;
+        }
+        last = value;
+        return false;
+    }
+
     //we need to have RQRef here due to [deref]
     //callback in destructor. Texture need to be released.
     RefPtr<RQRef> m_rqoRenderingQueue;
@@ -171,5 +251,15 @@ private:
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
 
+    // Statistics of the current buffer, reported to java on flush.
+    // Every [freeSpace] call is accounted as one operation,
+    // unless the state change it was made for is elided.
+    int m_opCount { 0 };
+    int m_elidedOpCount { 0 };
+
+    std::optional<Color> m_lastFillColor;
+    std::optional<Color> m_lastStrokeColor;
+    std::optional<jint> m_lastStrokeStyle;
+    std::optional<jfloat> m_lastStrokeThickness;
 };
 } // namespace WebCore
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include "TextShapingCacheJava.h"
+#include "Font.h"
+#include "PlatformJavaClasses.h"
+
+#include <wtf/java/JavaRef.h>
+
+namespace WebCore {
+
+namespace {
+
+// Reads the packed runs written by WCFontImpl.getTextRuns():
+//   int runCount
+//   runCount times:
+//     int flags (1 if left to right), int start, int end, int glyphCount
+//     glyphCount times: int glyph, int charOffset, float x, float y, float advance
+class PackedRunsReader {
+public:
+    PackedRunsReader(const uint8_t* data, size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    template<typename T> std::optional<T> read()
+    {
+        if (m_position + sizeof(T) > m_size)
+            return std::nullopt;
+        T value;
+        memcpy(&value, m_data + m_position, sizeof(T));
+        m_position += sizeof(T);
+        return value;
+    }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_position { 0 };
+};
+
+}
+
+const Vector<TextShapingCacheJava::Run>* TextShapingCacheJava::runsForText(RQRef& jFont, const Font& font, const String& text)
+{
+    auto it = m_runs.find(text);
+    if (it != m_runs.end())
+        return &it->value;
+
+    auto runs = shape(jFont, font, text);
+    if (!runs)
+        return nullptr;
+
+    if (m_keys.size() >= MAX_ENTRIES)
+        m_runs.remove(m_keys.takeFirst());
+    m_keys.append(text);
+    return &m_runs.add(text, WTFMove(*runs)).iterator->value;
+}
+
+std::optional<Vector<TextShapingCacheJava::Run>> TextShapingCacheJava::shape(RQRef& jFont, const Font& font, const String& text)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID getTextRuns_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getTextRuns", "(Ljava/lang/String;)Ljava/nio/ByteBuffer;");
+    ASSERT(getTextRuns_mID);
+
+    JLObject jBuffer(env->CallObjectMethod(jFont, getTextRuns_mID,
+        (jstring)text.toJavaString(env)));
+    if (WTF::CheckAndClearException(env) || !jBuffer)
+        return std::nullopt;
+
+    auto* data = static_cast<const uint8_t*>(env->GetDirectBufferAddress(jBuffer));
+    jlong capacity = env->GetDirectBufferCapacity(jBuffer);
+    if (!data || capacity <= 0)
+        return std::nullopt;
+
+    PackedRunsReader reader(data, capacity);
+    auto runCount = reader.read<jint>();
+    if (!runCount || *runCount < 0)
+        return std::nullopt;
+
+    Vector<Run> runs;
+    runs.reserveInitialCapacity(*runCount);
+    for (jint r = 0; r < *runCount; ++r) {
+        auto flags = reader.read<jint>();
+        auto start = reader.read<jint>();
+        auto end = reader.read<jint>();
+        auto glyphCount = reader.read<jint>();
+        if (!flags || !start || !end || !glyphCount || *glyphCount < 0)
+            return std::nullopt;
+
+        Run run;
+        run.ltr = *flags & 1;
+        run.indexBegin = *start;
+        run.indexEnd = *end;
+
+        if (!*glyphCount) {
+            // There won't be any glyph when TextRun contains a line break or a soft break.
+            // However WebCore expects us to return a empty value for all of it's query,
+            // a single empty glyph does the job.
+            run.glyphs.append(0);
+            run.stringIndices.append(run.indexBegin);
+            run.advances.append({ });
+            runs.append(WTFMove(run));
+            continue;
+        }
+
+        run.glyphs.reserveInitialCapacity(*glyphCount);
+        run.stringIndices.reserveInitialCapacity(*glyphCount);
+        run.advances.reserveInitialCapacity(*glyphCount);
+        for (jint i = 0; i < *glyphCount; ++i) {
+            auto glyph = reader.read<jint>();
+            auto charOffset = reader.read<jint>();
+            auto x = reader.read<jfloat>();
+            auto y = reader.read<jfloat>();
+            auto advance = reader.read<jfloat>();
+            if (!glyph || !charOffset || !x || !y || !advance)
+                return std::nullopt;
+
+            // FIXME(arajkumar): There is no way to get initial advance from Prism Font implementation.
+            // With trial and error I found that glyph 0's x,y position can be used as an alternative
+            // for initial advance.
+            if (!i)
+                run.initialAdvance = { *x, *y };
+
+            // The given string will be broken down into multiple java TextRuns. Each
+            // java TextRun will have indicies relative to it's text. So it has to
+            // be converted to absolute index w.r.t WebCore String.
+            // Refer {CTGlyphLayout, DWGlyphLayout, PangoGlyphLayout}.layout()
+            run.stringIndices.uncheckedAppend(run.indexBegin + *charOffset);
+            run.glyphs.uncheckedAppend(*glyph);
+            run.advances.uncheckedAppend(font.isZeroWidthSpaceGlyph(*glyph) ? FloatSize() : FloatSize(*advance, 0));
+        }
+        runs.uncheckedAppend(WTFMove(run));
+    }
+    return runs;
+}
+
+} // namespace WebCore
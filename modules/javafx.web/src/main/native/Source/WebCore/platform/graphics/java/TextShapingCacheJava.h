@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "FloatSize.h"
+#include "Glyph.h"
+#include "RQRef.h"
+
+#include <wtf/Deque.h>
+#include <wtf/HashMap.h>
+#include <wtf/Ref.h>
+#include <wtf/RefCounted.h>
+#include <wtf/Vector.h>
+#include <wtf/text/StringHash.h>
+#include <wtf/text/WTFString.h>
+
+namespace WebCore {
+
+class Font;
+
+/*
+ * Native cache of the text runs shaped by a java font. The runs of a string
+ * are returned by java in a single packed buffer, see WCFont.getTextRuns(),
+ * and kept for the following layouts of the same string.
+ */
+class TextShapingCacheJava : public RefCounted<TextShapingCacheJava> {
+public:
+    static const unsigned MAX_ENTRIES = 256;
+
+    struct Run {
+        Vector<FloatSize> advances;
+        Vector<Glyph> glyphs;
+        // Indices of the glyphs' characters in the shaped string.
+        Vector<unsigned> stringIndices;
+        FloatSize initialAdvance;
+        unsigned indexBegin { 0 };
+        unsigned indexEnd { 0 };
+        bool ltr { true };
+    };
+
+    static Ref<TextShapingCacheJava> create()
+    {
+        return adoptRef(*new TextShapingCacheJava());
+    }
+
+    // Returns nullptr if the text could not be shaped. The returned runs
+    // are valid until the next call.
+    const Vector<Run>* runsForText(RQRef& jFont, const Font&, const String& text);
+
+private:
+    TextShapingCacheJava() = default;
+
+    std::optional<Vector<Run>> shape(RQRef& jFont, const Font&, const String& text);
+
+    HashMap<String, Vector<Run>> m_runs;
+    // Insertion order of m_runs, the oldest entry is evicted first.
+    Deque<String> m_keys;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -123,8 +123,6 @@ bool RenderThemeJava::paintWidget(
             : CSSPropertyBackgroundColor
     );
 
-    JNIEnv* env = WTF::GetJavaEnv();
-
     WTF::Vector<jbyte> extParams;
     if (JNI_EXPAND(SLIDER) == widgetIndex && is<RenderSlider>(object)) {
         HTMLInputElement& input = downcast<RenderSlider>(object).element();
@@ -151,7 +149,10 @@ bool RenderThemeJava::paintWidget(
         if (is<RenderProgress>(object)) {
             const RenderProgress& renderProgress = downcast<RenderProgress>(object);
 
-            extParams.grow(sizeof(jint) + 3*sizeof(jfloat));
+            // The animation progress is not passed: the Java control animates
+            // indeterminate progress bars itself, and passing it would make
+            // every animation frame a widget cache miss.
+            extParams.grow(sizeof(jint) + sizeof(jfloat));
             jbyte *data = extParams.data();
             auto isDeterminate = jint(renderProgress.isDeterminate() ? 1 : 0);
             memcpy(data, &isDeterminate, sizeof(isDeterminate));
@@ -159,11 +160,6 @@ bool RenderThemeJava::paintWidget(
 
             auto position = jfloat(renderProgress.position());
             memcpy(data, &position, sizeof(position));
-            data += sizeof(jfloat);
-
-            auto animationProgress = jfloat(renderProgress.animationProgress());
-            memcpy(data, &animationProgress, sizeof(animationProgress));
-            data += sizeof(jfloat);
         }
     } else if (JNI_EXPAND(METER) == widgetIndex) {
         jfloat value = 0;
@@ -185,29 +181,49 @@ bool RenderThemeJava::paintWidget(
         memcpy(data, &region, sizeof(region));
     }
 
-    static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "createWidget",
-            "(JIIIIILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/Ref;");
-    ASSERT(mid);
-
     auto [r, g, b, a] = bgColor.toColorTypeLossy<SRGBA<uint8_t>>().resolved();
-    RefPtr<RQRef> widgetRef = RQRef::create(
-        env->CallObjectMethod(jobject(*jRenderTheme), mid,
-            ptr_to_jlong(&object),
-            (jint)widgetIndex,
-            (jint)state,
-            (jint)rect.width(), (jint)rect.height(),
-            (jint)(a << 24 | r << 16 | g << 8 | b),
-            (jobject)JLObject(extParams.isEmpty()
-                ? nullptr
-                : env->NewDirectByteBuffer(
-                    extParams.data(),
-                    extParams.size())))
-        );
-    if (!widgetRef.get()) {
-        //switch to WebKit default render
-        return true;
+    RenderThemeWidgetKey key {
+        (jint)*jRenderTheme,
+        widgetIndex,
+        state,
+        rect.size(),
+        uint32_t(a << 24 | r << 16 | g << 8 | b),
+        { }
+    };
+    ASSERT(extParams.size() <= sizeof(key.extParams));
+    memcpy(key.extParams.data(), extParams.data(), extParams.size());
+
+    RefPtr<RQRef> widgetRef = cachedWidget(object, key);
+    if (!widgetRef) {
+        JNIEnv* env = WTF::GetJavaEnv();
+
+        // createWidget() may evict controls from the Java pool.
+        notifyWidgetsUsed(env, key.themeID, jobject(*jRenderTheme));
+
+        static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "createWidget",
+                "(JIIIIILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/Ref;");
+        ASSERT(mid);
+
+        widgetRef = RQRef::create(
+            env->CallObjectMethod(jobject(*jRenderTheme), mid,
+                ptr_to_jlong(&object),
+                (jint)widgetIndex,
+                (jint)state,
+                (jint)rect.width(), (jint)rect.height(),
+                (jint)key.bgColor,
+                (jobject)JLObject(extParams.isEmpty()
+                    ? nullptr
+                    : env->NewDirectByteBuffer(
+                        extParams.data(),
+                        extParams.size())))
+            );
+        if (!widgetRef.get()) {
+            //switch to WebKit default render
+            return true;
+        }
+        WTF::CheckAndClearException(env);
+        cacheWidget(object, key, widgetRef.copyRef());
     }
-    WTF::CheckAndClearException(env);
 
     // widgetRef will go into rq's inner refs vector.
     paintInfo.context().platformContext()->rq().freeSpace(20)
@@ -219,6 +235,66 @@ bool RenderThemeJava::paintWidget(
     return false;
 }
 
+RefPtr<RQRef> RenderThemeJava::cachedWidget(const RenderObject& object, const RenderThemeWidgetKey& key)
+{
+    auto it = m_widgetCache.find(&object);
+    if (it == m_widgetCache.end() || it->value.key != key) {
+        ++m_widgetCacheMisses;
+        return nullptr;
+    }
+    ++m_widgetCacheHits;
+    it->value.lastUse = ++m_widgetCacheClock;
+    m_usedWidgets.ensure(key.themeID, [] {
+        return ListHashSet<jlong>();
+    }).iterator->value.appendOrMoveToLast(ptr_to_jlong(&object));
+    return it->value.ref;
+}
+
+void RenderThemeJava::notifyWidgetsUsed(JNIEnv* env, jint themeID, jobject jRenderTheme)
+{
+    auto ids = m_usedWidgets.take(themeID);
+    if (ids.isEmpty()) {
+        return;
+    }
+
+    static jmethodID mid = env->GetMethodID(PG_GetRenderThemeClass(env), "notifyWidgetsUsed", "([J)V");
+    ASSERT(mid);
+
+    JLocalRef<jlongArray> jids(env->NewLongArray(ids.size()));
+    if (!jids || WTF::CheckAndClearException(env)) {
+        return;
+    }
+    Vector<jlong> values = copyToVector(ids);
+    env->SetLongArrayRegion((jlongArray)jids, 0, values.size(), values.data());
+    env->CallVoidMethod(jRenderTheme, mid, (jlongArray)jids);
+    WTF::CheckAndClearException(env);
+}
+
+void RenderThemeJava::cacheWidget(const RenderObject& object, const RenderThemeWidgetKey& key, RefPtr<RQRef>&& widgetRef)
+{
+    static constexpr unsigned maxCachedWidgets = 512;
+
+    if (m_widgetCache.size() >= maxCachedWidgets && !m_widgetCache.contains(&object)) {
+        auto leastRecentlyUsed = std::min_element(m_widgetCache.begin(), m_widgetCache.end(), [](auto& a, auto& b) {
+            return a.value.lastUse < b.value.lastUse;
+        });
+        m_widgetCache.remove(leastRecentlyUsed);
+    }
+    m_widgetCache.set(&object, CachedWidget { key, WTFMove(widgetRef), ++m_widgetCacheClock });
+}
+
+void RenderThemeJava::invalidateWidget(jint themeID, jlong objectID)
+{
+    auto it = m_widgetCache.find(static_cast<const RenderObject*>(jlong_to_ptr(objectID)));
+    if (it != m_widgetCache.end() && it->value.key.themeID == themeID) {
+        m_widgetCache.remove(it);
+    }
+    auto used = m_usedWidgets.find(themeID);
+    if (used != m_usedWidgets.end()) {
+        used->value.remove(objectID);
+    }
+}
+
 void RenderThemeJava::adjustProgressBarStyle(RenderStyle& style, const Element*) const
 {
     style.setBoxShadow(nullptr);
@@ -567,5 +643,29 @@ String RenderThemeJava::mediaControlsBase64StringForIconNameAndType(const String
 
 }
 
+using namespace WebCore;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_RenderTheme_twkInvalidateWidget
+    (JNIEnv*, jclass, jint themeID, jlong id)
+{
+    static_cast<RenderThemeJava&>(RenderTheme::singleton()).invalidateWidget(themeID, id);
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_graphics_RenderTheme_twkGetWidgetCacheHits
+    (JNIEnv*, jclass)
+{
+    return static_cast<RenderThemeJava&>(RenderTheme::singleton()).widgetCacheHits();
+}
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_graphics_RenderTheme_twkGetWidgetCacheMisses
+    (JNIEnv*, jclass)
+{
+    return static_cast<RenderThemeJava&>(RenderTheme::singleton()).widgetCacheMisses();
+}
+
+} // extern "C"
+
 #undef JNI_EXPAND
 
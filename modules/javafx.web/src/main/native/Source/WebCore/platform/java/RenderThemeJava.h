@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,8 +31,12 @@
 #include "StyleResolver.h"
 #include "RenderStyleSetters.h"
 #include "RenderStyleInlines.h"
+#include "RQRef.h"
 
+#include <array>
 #include <jni.h>
+#include <wtf/HashMap.h>
+#include <wtf/ListHashSet.h>
 
 namespace WebCore {
 
@@ -43,10 +47,28 @@ struct ThemeData {
     unsigned m_state;
 };
 
+// Everything the Java theme is told about a widget when it is created.
+struct RenderThemeWidgetKey {
+    jint themeID { 0 };
+    int widgetIndex { 0 };
+    int state { 0 };
+    IntSize size;
+    uint32_t bgColor { 0 };
+    std::array<uint32_t, 4> extParams { };
+
+    friend bool operator==(const RenderThemeWidgetKey&, const RenderThemeWidgetKey&) = default;
+};
+
 class RenderThemeJava final : public RenderTheme {
 public:
     RenderThemeJava();
 
+    // Called when the Java theme with the given ID drops the control of
+    // the render object with the given ID.
+    void invalidateWidget(jint themeID, jlong objectID);
+    uint64_t widgetCacheHits() const { return m_widgetCacheHits; }
+    uint64_t widgetCacheMisses() const { return m_widgetCacheMisses; }
+
     // A method asking if the theme's controls actually care about redrawing when hovered.
     bool supportsHover(const RenderStyle&) const override { return true; }
 
@@ -119,8 +141,27 @@ private:
                      const PaintInfo& i, const IntRect& rect);
     bool paintWidget(int widgetIndex, const RenderObject& o,
                      const PaintInfo& i, const FloatRect& rect);
+    RefPtr<RQRef> cachedWidget(const RenderObject&, const RenderThemeWidgetKey&);
+    void cacheWidget(const RenderObject&, const RenderThemeWidgetKey&, RefPtr<RQRef>&&);
+    void notifyWidgetsUsed(JNIEnv*, jint themeID, jobject jRenderTheme);
     Color getSelectionColor(int index) const;
     std::unique_ptr<MediaControlResource> mediaResource;
+
+    // The Java theme keeps one control per render object and updates it
+    // in createWidget(), so the widget created last for an object can be
+    // drawn again as long as the object's appearance has not changed.
+    struct CachedWidget {
+        RenderThemeWidgetKey key;
+        RefPtr<RQRef> ref;
+        uint64_t lastUse { 0 };
+    };
+    HashMap<const RenderObject*, CachedWidget> m_widgetCache;
+    // IDs of the objects drawn from the cache since the Java theme was last
+    // told, least recently used first, so that it keeps their controls.
+    HashMap<jint, ListHashSet<jlong>> m_usedWidgets;
+    uint64_t m_widgetCacheClock { 0 };
+    uint64_t m_widgetCacheHits { 0 };
+    uint64_t m_widgetCacheMisses { 0 };
 #if ENABLE(VIDEO)
     bool paintMediaControl(jint type, const RenderObject&, const PaintInfo&, const IntRect&);
 #endif
@@ -1,5 +1,6 @@
 /*
  * Copyright (C) 2008 Apple Inc.  All rights reserved.
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -28,28 +29,144 @@
 
 #if PLATFORM(JAVA)
 
-#include "NotImplemented.h"
+#include "com_sun_webkit_network_DNSResolver.h"
+#include <wtf/CompletionHandler.h>
+#include <wtf/java/JavaEnv.h>
+#include <wtf/java/JavaRef.h>
 
 namespace WebCore {
 
+namespace DNSResolveQueueJavaInternal {
+
+static JGClass dnsResolverClass;
+
+static jclass GetDNSResolverClass(JNIEnv* env)
+{
+    if (!dnsResolverClass) {
+        dnsResolverClass = JLClass(env->FindClass(
+                "com/sun/webkit/network/DNSResolver"));
+        ASSERT(dnsResolverClass);
+    }
+    return dnsResolverClass;
+}
+
+} // namespace DNSResolveQueueJavaInternal
+
+using namespace DNSResolveQueueJavaInternal;
+
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    WC_GETJAVAENV_CHKRET(env);
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkIsUsingProxy",
+            "()Z");
+    ASSERT(mid);
+
+    jboolean usingProxy = env->CallStaticBooleanMethod(GetDNSResolverClass(env), mid);
+    if (WTF::CheckAndClearException(env)) {
+        return;
+    }
+    m_isUsingProxy = jbool_to_bool(usingProxy);
+}
+
+void DNSResolveQueueJava::platformResolve(const String& hostname)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env) {
+        decrementRequestCount();
+        return;
+    }
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkPrefetch",
+            "(Ljava/lang/String;)V");
+    ASSERT(mid);
+
+    env->CallStaticVoidMethod(GetDNSResolverClass(env), mid,
+            (jstring) hostname.toJavaString(env));
+    if (WTF::CheckAndClearException(env)) {
+        decrementRequestCount();
+    }
+}
+
+void DNSResolveQueueJava::resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&& completionHandler)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env) {
+        completionHandler(makeUnexpected(DNSError::Unknown));
+        return;
+    }
+
+    static jmethodID mid = env->GetStaticMethodID(
+            GetDNSResolverClass(env),
+            "fwkResolve",
+            "(Ljava/lang/String;J)V");
+    ASSERT(mid);
+
+    m_pendingRequests.set(identifier, WTFMove(completionHandler));
+    env->CallStaticVoidMethod(GetDNSResolverClass(env), mid,
+            (jstring) hostname.toJavaString(env), static_cast<jlong>(identifier));
+    if (WTF::CheckAndClearException(env)) {
+        didResolve(identifier, makeUnexpected(DNSError::Unknown));
+    }
 }
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+void DNSResolveQueueJava::stopResolve(uint64_t identifier)
 {
-    notImplemented();
+    // The lookup itself keeps running and fills the cache, only the
+    // completion handler is dropped.
+    didResolve(identifier, makeUnexpected(DNSError::Cancelled));
 }
 
-void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
+void DNSResolveQueueJava::didResolve(uint64_t identifier, DNSAddressesOrError&& result)
 {
-    notImplemented();
+    auto completionHandler = m_pendingRequests.take(identifier);
+    if (completionHandler) {
+        completionHandler(WTFMove(result));
+    }
 }
 
-void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
+} // namespace WebCore
+
+using namespace WebCore;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_DNSResolver_twkDidPrefetch
+    (JNIEnv*, jclass)
+{
+    // Called on a resolver thread, the request count is atomic.
+    DNSResolveQueue::singleton().decrementRequestCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_DNSResolver_twkDidResolve
+    (JNIEnv* env, jclass, jlong identifier, jobjectArray addresses)
 {
-    notImplemented();
+    auto& queue = static_cast<DNSResolveQueueJava&>(DNSResolveQueue::singleton());
+    if (!addresses) {
+        queue.didResolve(identifier, makeUnexpected(DNSError::CannotResolve));
+        return;
+    }
+
+    Vector<IPAddress> result;
+    jsize count = env->GetArrayLength(addresses);
+    for (jsize i = 0; i < count; ++i) {
+        JLByteArray address(static_cast<jbyteArray>(env->GetObjectArrayElement(addresses, i)));
+        jsize length = env->GetArrayLength(address);
+        if (length == sizeof(struct in_addr)) {
+            struct in_addr addressV4;
+            env->GetByteArrayRegion(address, 0, length, reinterpret_cast<jbyte*>(&addressV4));
+            result.append(IPAddress { addressV4 });
+        } else if (length == sizeof(struct in6_addr)) {
+            struct in6_addr addressV6;
+            env->GetByteArrayRegion(address, 0, length, reinterpret_cast<jbyte*>(&addressV6));
+            result.append(IPAddress { addressV6 });
+        }
+    }
+    queue.didResolve(identifier, WTFMove(result));
 }
 
 }
@@ -1,5 +1,6 @@
 /*
  * Copyright (C) 2018 Igalia S.L.
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -26,6 +27,7 @@
 #pragma once
 
 #include "DNSResolveQueue.h"
+#include <wtf/HashMap.h>
 
 namespace WebCore {
 
@@ -35,9 +37,14 @@ public:
     void resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&&) final;
     void stopResolve(uint64_t identifier) final;
 
+    void didResolve(uint64_t identifier, DNSAddressesOrError&&);
+
 private:
     void updateIsUsingProxy() final;
     void platformResolve(const String&) final;
+
+    // Identifiers are chosen by the callers of resolveDNS() and may be 0.
+    HashMap<uint64_t, DNSCompletionHandler, DefaultHash<uint64_t>, WTF::UnsignedWithZeroKeyHashTraits<uint64_t>> m_pendingRequests;
 };
 
 using DNSResolveQueuePlatform = DNSResolveQueueJava;
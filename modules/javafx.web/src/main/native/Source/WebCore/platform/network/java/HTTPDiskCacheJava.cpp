@@ -0,0 +1,633 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "HTTPDiskCacheJava.h"
+
+#include "CacheValidation.h"
+#include "HTTPHeaderNames.h"
+#include "HTTPParsers.h"
+#include "ResourceRequest.h"
+#include "com_sun_webkit_network_NetworkContext.h"
+#include <wtf/FileSystem.h>
+#include <wtf/SHA1.h>
+#include <wtf/java/JavaEnv.h>
+#include <wtf/java/JavaRef.h>
+#include <wtf/text/StringBuilder.h>
+#include <wtf/text/StringToIntegerConversion.h>
+
+#if OS(UNIX)
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+namespace WebCore {
+
+namespace HTTPDiskCacheJavaInternal {
+
+static constexpr auto headersVersion = "1"_s;
+static constexpr auto headersSuffix = ".headers"_s;
+static constexpr auto bodySuffix = ".body"_s;
+static constexpr auto temporarySuffix = ".tmp"_s;
+
+static bool hasValidators(const ResourceResponse& response)
+{
+    return !response.httpHeaderField(HTTPHeaderName::ETag).isEmpty()
+        || !response.httpHeaderField(HTTPHeaderName::LastModified).isEmpty();
+}
+
+static CString encodeHeaders(const URL& url, const Vector<std::pair<String, String>>& varyingRequestHeaders,
+    const HTTPDiskCacheJava::Entry& entry, uint64_t bodySize)
+{
+    const auto& response = entry.response;
+    StringBuilder builder;
+    builder.append(headersVersion, '\n');
+    builder.append(url.string(), '\n');
+    builder.append(static_cast<int64_t>(entry.responseTimestamp.secondsSinceEpoch().milliseconds()), '\n');
+    builder.append(response.httpStatusCode(), '\n');
+    builder.append(response.httpStatusText(), '\n');
+    builder.append(response.mimeType(), '\n');
+    builder.append(response.textEncodingName(), '\n');
+    builder.append(bodySize, '\n');
+    builder.append(varyingRequestHeaders.size(), '\n');
+    for (const auto& header : varyingRequestHeaders)
+        builder.append(header.first, '\n', header.second, '\n');
+    unsigned headerCount = 0;
+    for (const auto& header : response.httpHeaderFields()) {
+        // Cookies are stored by the cookie jar, never in the cache.
+        if (equalLettersIgnoringASCIICase(header.key, "set-cookie"_s))
+            continue;
+        headerCount++;
+    }
+    builder.append(headerCount, '\n');
+    for (const auto& header : response.httpHeaderFields()) {
+        if (equalLettersIgnoringASCIICase(header.key, "set-cookie"_s))
+            continue;
+        builder.append(header.key, '\n', header.value, '\n');
+    }
+    return builder.toString().utf8();
+}
+
+struct DecodedHeaders {
+    ResourceResponse response;
+    WallTime responseTimestamp;
+    Vector<std::pair<String, String>> varyingRequestHeaders;
+    uint64_t bodySize { 0 };
+};
+
+static std::optional<DecodedHeaders> decodeHeaders(const Vector<char>& data, const URL& url)
+{
+    auto lines = String::fromUTF8(data.data(), data.size()).splitAllowingEmptyEntries('\n');
+    size_t index = 0;
+    auto nextLine = [&] () -> std::optional<String> {
+        if (index >= lines.size())
+            return std::nullopt;
+        return lines[index++];
+    };
+    auto nextInteger = [&] () -> std::optional<uint64_t> {
+        auto line = nextLine();
+        return line ? parseInteger<uint64_t>(*line) : std::nullopt;
+    };
+    auto nextPairs = [&] (Vector<std::pair<String, String>>& pairs) {
+        auto count = nextInteger();
+        if (!count || *count > lines.size())
+            return false;
+        for (uint64_t i = 0; i < *count; i++) {
+            auto name = nextLine();
+            auto value = nextLine();
+            if (!name || !value)
+                return false;
+            pairs.append({ WTFMove(*name), WTFMove(*value) });
+        }
+        return true;
+    };
+
+    if (nextLine() != String(headersVersion))
+        return std::nullopt;
+    // Two URLs with the same hash would share an entry.
+    if (nextLine() != url.string())
+        return std::nullopt;
+
+    DecodedHeaders result;
+    auto timestamp = nextInteger();
+    auto statusCode = nextInteger();
+    auto statusText = nextLine();
+    auto mimeType = nextLine();
+    auto textEncodingName = nextLine();
+    auto bodySize = nextInteger();
+    if (!timestamp || !statusCode || !statusText || !mimeType || !textEncodingName || !bodySize)
+        return std::nullopt;
+
+    Vector<std::pair<String, String>> responseHeaders;
+    if (!nextPairs(result.varyingRequestHeaders) || !nextPairs(responseHeaders))
+        return std::nullopt;
+
+    result.responseTimestamp = WallTime::fromRawSeconds(Seconds::fromMilliseconds(*timestamp).value());
+    result.bodySize = *bodySize;
+
+    auto& response = result.response;
+    response.setURL(url);
+    response.setHTTPStatusCode(*statusCode);
+    response.setHTTPStatusText(AtomString { *statusText });
+    response.setMimeType(AtomString { *mimeType });
+    response.setTextEncodingName(AtomString { *textEncodingName });
+    response.setExpectedContentLength(*bodySize);
+    for (auto& header : responseHeaders)
+        response.setHTTPHeaderField(header.first, header.second);
+    response.setSource(ResourceResponse::Source::DiskCache);
+    return result;
+}
+
+#if OS(UNIX)
+
+static bool writeAll(int fd, const char* data, size_t length)
+{
+    while (length) {
+        ssize_t written = ::write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        data += written;
+        length -= written;
+    }
+    return true;
+}
+
+// Writes a file next to its final location and renames it into place, so
+// that a reader never sees a partially written file.
+template<typename WriteFunction>
+static bool writeFileAtomically(const String& path, const WriteFunction& writeFunction)
+{
+    CString finalPath = path.utf8();
+    CString temporaryPath = makeString(path, temporarySuffix).utf8();
+    int fd = ::open(temporaryPath.data(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd < 0)
+        return false;
+    bool success = writeFunction(fd);
+    success = !::close(fd) && success;
+    if (!success || ::rename(temporaryPath.data(), finalPath.data())) {
+        ::unlink(temporaryPath.data());
+        return false;
+    }
+    return true;
+}
+
+static std::optional<Vector<char>> readFile(const String& path)
+{
+    int fd = ::open(path.utf8().data(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return std::nullopt;
+    Vector<char> data;
+    char buffer[4096];
+    while (true) {
+        ssize_t count = ::read(fd, buffer, sizeof(buffer));
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0) {
+            ::close(fd);
+            if (count < 0)
+                return std::nullopt;
+            return data;
+        }
+        data.append(buffer, count);
+    }
+}
+
+static uint64_t fileSize(const String& path)
+{
+    struct stat fileStat;
+    if (::stat(path.utf8().data(), &fileStat))
+        return 0;
+    return fileStat.st_size;
+}
+
+class MappedBody {
+    WTF_MAKE_NONCOPYABLE(MappedBody);
+public:
+    MappedBody(void* data, size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    MappedBody(MappedBody&& other)
+        : m_data(std::exchange(other.m_data, nullptr))
+        , m_size(other.m_size)
+    {
+    }
+
+    ~MappedBody()
+    {
+        if (m_data)
+            ::munmap(m_data, m_size);
+    }
+
+    const uint8_t* data() const { return static_cast<const uint8_t*>(m_data); }
+
+private:
+    void* m_data;
+    size_t m_size;
+};
+
+// Maps the body file into memory, so that the data is not copied before
+// it is handed to WebCore and pages that are never read are never loaded.
+static RefPtr<SharedBuffer> mapBody(const String& path, uint64_t expectedSize)
+{
+    int fd = ::open(path.utf8().data(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return nullptr;
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) || static_cast<uint64_t>(fileStat.st_size) != expectedSize) {
+        ::close(fd);
+        return nullptr;
+    }
+    if (!expectedSize) {
+        ::close(fd);
+        return SharedBuffer::create();
+    }
+    size_t size = expectedSize;
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+        return nullptr;
+    return SharedBuffer::create(DataSegment::Provider {
+        [body = MappedBody(data, size)]() { return body.data(); },
+        [size]() { return size; }
+    });
+}
+
+#endif // OS(UNIX)
+
+} // namespace HTTPDiskCacheJavaInternal
+
+HTTPDiskCacheJava& HTTPDiskCacheJava::singleton()
+{
+    static NeverDestroyed<HTTPDiskCacheJava> cache;
+    return cache;
+}
+
+void HTTPDiskCacheJava::configure(const String& directory, uint64_t capacity)
+{
+    ASSERT(isMainThread());
+    if (m_queue) {
+        // Let the pending writes finish with the old configuration.
+        m_queue->dispatchSync([] { });
+        m_queue = nullptr;
+    }
+
+#if OS(UNIX)
+    if (directory.isEmpty() || !capacity || !FileSystem::makeAllDirectories(directory))
+        return;
+
+    m_directory = directory;
+    m_capacity = capacity;
+    m_size = std::nullopt;
+    m_queue = WorkQueue::create("com.sun.webkit.HTTPDiskCache");
+    // Entries left by an earlier run count against the capacity.
+    m_queue->dispatch([this] {
+        shrinkIfNeeded();
+    });
+#else
+    UNUSED_PARAM(directory);
+    UNUSED_PARAM(capacity);
+#endif
+}
+
+bool HTTPDiskCacheJava::canRetrieve(const ResourceRequest& request)
+{
+    if (!request.url().protocolIsInHTTPFamily() || request.httpMethod() != "GET"_s)
+        return false;
+    // Conditional and range requests come from a cache above this one.
+    if (request.isConditional() || request.hasHTTPHeaderField(HTTPHeaderName::Range))
+        return false;
+    switch (request.cachePolicy()) {
+    case ResourceRequestCachePolicy::ReloadIgnoringCacheData:
+    case ResourceRequestCachePolicy::DoNotUseAnyCache:
+        return false;
+    default:
+        return true;
+    }
+}
+
+bool HTTPDiskCacheJava::canStore(const ResourceRequest& request, const ResourceResponse& response)
+{
+    using namespace HTTPDiskCacheJavaInternal;
+    if (!request.url().protocolIsInHTTPFamily() || request.httpMethod() != "GET"_s)
+        return false;
+    if (request.isConditional() || request.hasHTTPHeaderField(HTTPHeaderName::Range))
+        return false;
+    if (request.cachePolicy() == ResourceRequestCachePolicy::DoNotUseAnyCache)
+        return false;
+    if (request.hasHTTPHeaderField(HTTPHeaderName::Authorization))
+        return false;
+    if (response.httpStatusCode() != 200)
+        return false;
+    if (response.httpHeaderField(HTTPHeaderName::Vary).contains('*'))
+        return false;
+    if (parseCacheControlDirectives(request.httpHeaderFields()).noStore
+        || parseCacheControlDirectives(response.httpHeaderFields()).noStore)
+        return false;
+    return hasValidators(response)
+        || computeFreshnessLifetimeForHTTPFamily(response, WallTime::now()) > 0_s;
+}
+
+auto HTTPDiskCacheJava::useDecision(const ResourceRequest& request, const Entry& entry) -> UseDecision
+{
+    using namespace HTTPDiskCacheJavaInternal;
+    switch (request.cachePolicy()) {
+    case ResourceRequestCachePolicy::ReturnCacheDataElseLoad:
+    case ResourceRequestCachePolicy::ReturnCacheDataDontLoad:
+        return UseDecision::Use;
+    case ResourceRequestCachePolicy::ReloadIgnoringCacheData:
+    case ResourceRequestCachePolicy::DoNotUseAnyCache:
+        return UseDecision::NoUse;
+    case ResourceRequestCachePolicy::RefreshAnyCacheData:
+        return hasValidators(entry.response) ? UseDecision::Validate : UseDecision::NoUse;
+    case ResourceRequestCachePolicy::UseProtocolCachePolicy:
+        break;
+    }
+
+    auto requestDirectives = parseCacheControlDirectives(request.httpHeaderFields());
+    auto responseDirectives = parseCacheControlDirectives(entry.response.httpHeaderFields());
+    if (!requestDirectives.noCache && !responseDirectives.noCache) {
+        Seconds lifetime = computeFreshnessLifetimeForHTTPFamily(entry.response, entry.responseTimestamp);
+        if (requestDirectives.maxAge)
+            lifetime = std::min(lifetime, *requestDirectives.maxAge);
+        if (computeCurrentAge(entry.response, entry.responseTimestamp) < lifetime)
+            return UseDecision::Use;
+    }
+    return hasValidators(entry.response) ? UseDecision::Validate : UseDecision::NoUse;
+}
+
+void HTTPDiskCacheJava::makeConditional(ResourceRequest& request, const Entry& entry)
+{
+    String eTag = entry.response.httpHeaderField(HTTPHeaderName::ETag);
+    if (!eTag.isEmpty())
+        request.setHTTPHeaderField(HTTPHeaderName::IfNoneMatch, eTag);
+    String lastModified = entry.response.httpHeaderField(HTTPHeaderName::LastModified);
+    if (!lastModified.isEmpty())
+        request.setHTTPHeaderField(HTTPHeaderName::IfModifiedSince, lastModified);
+}
+
+String HTTPDiskCacheJava::pathForKey(const ResourceRequest& request) const
+{
+    URL url = request.url();
+    url.removeFragmentIdentifier();
+    SHA1 sha1;
+    sha1.addBytes(url.string().utf8());
+    SHA1::Digest digest;
+    sha1.computeHash(digest);
+    return makeString(m_directory, '/', SHA1::hexDigest(digest).data());
+}
+
+std::unique_ptr<HTTPDiskCacheJava::Entry> HTTPDiskCacheJava::retrieve(const ResourceRequest& request, NetworkStorageSession* storageSession)
+{
+#if OS(UNIX)
+    using namespace HTTPDiskCacheJavaInternal;
+    ASSERT(isMainThread() && m_queue);
+    String path = pathForKey(request);
+    auto data = readFile(makeString(path, headersSuffix));
+    if (!data)
+        return nullptr;
+
+    URL url = request.url();
+    url.removeFragmentIdentifier();
+    auto headers = decodeHeaders(*data, url);
+    if (!headers)
+        return nullptr;
+    if (!headers->varyingRequestHeaders.isEmpty()
+        && !verifyVaryingRequestHeaders(storageSession, headers->varyingRequestHeaders, request))
+        return nullptr;
+
+    // The body may have been replaced by a newer response since the
+    // headers were read.
+    auto body = mapBody(makeString(path, bodySuffix), headers->bodySize);
+    if (!body)
+        return nullptr;
+
+    // Touch the entry, eviction removes the least recently used first.
+    m_queue->dispatch([headersPath = makeString(path, headersSuffix).isolatedCopy()] {
+        ::utimes(headersPath.utf8().data(), nullptr);
+    });
+
+    return makeUnique<Entry>(Entry {
+        WTFMove(headers->response),
+        headers->responseTimestamp,
+        WTFMove(headers->varyingRequestHeaders),
+        body.releaseNonNull()
+    });
+#else
+    UNUSED_PARAM(request);
+    UNUSED_PARAM(storageSession);
+    return nullptr;
+#endif
+}
+
+void HTTPDiskCacheJava::store(const ResourceRequest& request, const ResourceResponse& response, NetworkStorageSession* storageSession, Ref<FragmentedSharedBuffer>&& body)
+{
+#if OS(UNIX)
+    using namespace HTTPDiskCacheJavaInternal;
+    ASSERT(isMainThread() && m_queue);
+    if (body->size() > maximumEntrySize())
+        return;
+
+    Vector<std::pair<String, String>> varyingRequestHeaders;
+    if (!response.httpHeaderField(HTTPHeaderName::Vary).isEmpty()) {
+        // Without a session the varying cookies can not be recorded.
+        if (!storageSession)
+            return;
+        varyingRequestHeaders = collectVaryingRequestHeaders(storageSession, request, response);
+    }
+
+    URL url = request.url();
+    url.removeFragmentIdentifier();
+    Entry entry { response, WallTime::now(), { }, SharedBuffer::create() };
+    CString headers = encodeHeaders(url, varyingRequestHeaders, entry, body->size());
+
+    m_queue->dispatch([this, path = pathForKey(request).isolatedCopy(), headers = WTFMove(headers), body = WTFMove(body)] () mutable {
+        // Don't write to a directory that can not be scanned for eviction.
+        shrinkIfNeeded();
+        if (!m_size)
+            return;
+
+        // The old headers go first and the new ones are written last, so
+        // that a lookup never pairs headers with the body of another
+        // response. Bodies left without headers are removed by eviction.
+        ::unlink(makeString(path, headersSuffix).utf8().data());
+        bool written = writeFileAtomically(makeString(path, bodySuffix), [&] (int fd) {
+            for (const auto& segment : body.get()) {
+                if (!writeAll(fd, reinterpret_cast<const char*>(segment.segment->data()), segment.segment->size()))
+                    return false;
+            }
+            return true;
+        });
+        if (!written)
+            return;
+        writeHeaders(path, WTFMove(headers));
+        *m_size += body->size();
+        shrinkIfNeeded();
+    });
+#else
+    UNUSED_PARAM(request);
+    UNUSED_PARAM(response);
+    UNUSED_PARAM(storageSession);
+    UNUSED_PARAM(body);
+#endif
+}
+
+void HTTPDiskCacheJava::update(const ResourceRequest& request, Entry& entry, const ResourceResponse& validatingResponse)
+{
+    using namespace HTTPDiskCacheJavaInternal;
+    ASSERT(isMainThread() && m_queue);
+    updateResponseHeadersAfterRevalidation(entry.response, validatingResponse);
+    entry.responseTimestamp = WallTime::now();
+
+    URL url = request.url();
+    url.removeFragmentIdentifier();
+    CString headers = encodeHeaders(url, entry.varyingRequestHeaders, entry, entry.body->size());
+    m_queue->dispatch([this, path = pathForKey(request).isolatedCopy(), headers = WTFMove(headers)] () mutable {
+        if (m_size)
+            writeHeaders(path, WTFMove(headers));
+    });
+}
+
+void HTTPDiskCacheJava::remove(const ResourceRequest& request)
+{
+#if OS(UNIX)
+    using namespace HTTPDiskCacheJavaInternal;
+    ASSERT(isMainThread() && m_queue);
+    m_queue->dispatch([path = pathForKey(request).isolatedCopy()] {
+        ::unlink(makeString(path, headersSuffix).utf8().data());
+        ::unlink(makeString(path, bodySuffix).utf8().data());
+    });
+#else
+    UNUSED_PARAM(request);
+#endif
+}
+
+void HTTPDiskCacheJava::writeHeaders(const String& path, CString&& headers)
+{
+#if OS(UNIX)
+    using namespace HTTPDiskCacheJavaInternal;
+    ASSERT(!isMainThread());
+    bool written = writeFileAtomically(makeString(path, headersSuffix), [&] (int fd) {
+        return writeAll(fd, headers.data(), headers.length());
+    });
+    if (written)
+        *m_size += headers.length();
+#else
+    UNUSED_PARAM(path);
+    UNUSED_PARAM(headers);
+#endif
+}
+
+void HTTPDiskCacheJava::shrinkIfNeeded()
+{
+#if OS(UNIX)
+    using namespace HTTPDiskCacheJavaInternal;
+    ASSERT(!isMainThread());
+    if (m_size && *m_size <= m_capacity)
+        return;
+
+    // m_size only ever grows between scans, replaced entries are counted
+    // twice. Scan the directory for the real size before evicting.
+    struct CachedFile {
+        String path;
+        time_t lastUsed;
+        uint64_t size;
+    };
+    Vector<CachedFile> files;
+    uint64_t totalSize = 0;
+
+    CString directoryPath = m_directory.utf8();
+    DIR* directory = ::opendir(directoryPath.data());
+    if (!directory) {
+        m_size = std::nullopt;
+        return;
+    }
+    while (auto* directoryEntry = ::readdir(directory)) {
+        String name = String::fromUTF8(directoryEntry->d_name);
+        String filePath = makeString(m_directory, '/', name);
+        if (name.endsWith(temporarySuffix)) {
+            ::unlink(filePath.utf8().data());
+            continue;
+        }
+        if (name.endsWith(bodySuffix)) {
+            String headersPath = makeString(filePath.left(filePath.length() - bodySuffix.length()), headersSuffix);
+            if (::access(headersPath.utf8().data(), F_OK))
+                ::unlink(filePath.utf8().data());
+            continue;
+        }
+        if (!name.endsWith(headersSuffix))
+            continue;
+
+        String path = filePath.left(filePath.length() - headersSuffix.length());
+        struct stat headersStat;
+        if (::stat(filePath.utf8().data(), &headersStat))
+            continue;
+        uint64_t size = headersStat.st_size + fileSize(makeString(path, bodySuffix));
+        files.append({ WTFMove(path), headersStat.st_mtime, size });
+        totalSize += size;
+    }
+    ::closedir(directory);
+
+    if (totalSize > m_capacity) {
+        std::sort(files.begin(), files.end(), [] (const auto& a, const auto& b) {
+            return a.lastUsed < b.lastUsed;
+        });
+        // Leave some room, so that every store does not scan again.
+        uint64_t targetSize = m_capacity / 10 * 9;
+        for (const auto& file : files) {
+            if (totalSize <= targetSize)
+                break;
+            ::unlink(makeString(file.path, headersSuffix).utf8().data());
+            ::unlink(makeString(file.path, bodySuffix).utf8().data());
+            totalSize -= file.size;
+        }
+    }
+    m_size = totalSize;
+#endif
+}
+
+} // namespace WebCore
+
+using namespace WebCore;
+
+extern "C" {
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_NetworkContext_twkSetHTTPCacheConfiguration
+    (JNIEnv* env, jclass, jstring directory, jlong capacity)
+{
+    HTTPDiskCacheJava::singleton().configure(directory ? String(env, directory) : String(), capacity > 0 ? capacity : 0);
+}
+
+} // extern "C"
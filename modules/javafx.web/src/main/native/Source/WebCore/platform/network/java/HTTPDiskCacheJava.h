@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "ResourceResponse.h"
+#include "SharedBuffer.h"
+#include <optional>
+#include <wtf/Forward.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/WallTime.h>
+#include <wtf/WorkQueue.h>
+#include <wtf/text/CString.h>
+
+namespace WebCore {
+
+class NetworkStorageSession;
+class ResourceRequest;
+
+// Persistent HTTP cache in front of the Java network stack. Entries are
+// keyed on the request URL and kept as two files in the cache directory:
+// a small text file with the response headers and the varying request
+// headers, and the response body, which is memory mapped when the entry
+// is used. Fresh entries are served without calling into Java, stale
+// entries with validators are revalidated with a conditional request.
+//
+// The cache is disabled unless the "com.sun.webkit.httpCache.directory"
+// system property names a directory. Java passes the configuration in
+// whenever it changes, see NetworkContext.updateHTTPCacheConfiguration.
+// All file writes happen on a work queue, lookups on the main thread.
+class HTTPDiskCacheJava {
+    WTF_MAKE_NONCOPYABLE(HTTPDiskCacheJava);
+    WTF_MAKE_FAST_ALLOCATED;
+public:
+    struct Entry {
+        WTF_MAKE_STRUCT_FAST_ALLOCATED;
+
+        ResourceResponse response;
+        WallTime responseTimestamp;
+        Vector<std::pair<String, String>> varyingRequestHeaders;
+        Ref<SharedBuffer> body;
+    };
+
+    enum class UseDecision : uint8_t { Use, Validate, NoUse };
+
+    static HTTPDiskCacheJava& singleton();
+
+    bool isEnabled() const { return !!m_queue; }
+    void configure(const String& directory, uint64_t capacity);
+
+    static bool canRetrieve(const ResourceRequest&);
+    static bool canStore(const ResourceRequest&, const ResourceResponse&);
+    static UseDecision useDecision(const ResourceRequest&, const Entry&);
+    static void makeConditional(ResourceRequest&, const Entry&);
+
+    size_t maximumEntrySize() const { return m_capacity / 8; }
+
+    std::unique_ptr<Entry> retrieve(const ResourceRequest&, NetworkStorageSession*);
+    void store(const ResourceRequest&, const ResourceResponse&, NetworkStorageSession*, Ref<FragmentedSharedBuffer>&&);
+    void update(const ResourceRequest&, Entry&, const ResourceResponse& validatingResponse);
+    void remove(const ResourceRequest&);
+
+private:
+    friend class NeverDestroyed<HTTPDiskCacheJava>;
+    HTTPDiskCacheJava() = default;
+
+    String pathForKey(const ResourceRequest&) const;
+    void writeHeaders(const String& path, CString&& headers);
+    void shrinkIfNeeded();
+
+    RefPtr<WorkQueue> m_queue;
+    String m_directory;
+    uint64_t m_capacity { 0 };
+
+    // Only accessed on m_queue. Unknown until the directory has been
+    // scanned, nothing is written while the directory can not be read.
+    std::optional<uint64_t> m_size;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -44,9 +44,11 @@
 #include "SharedBuffer.h"
 #include "URLLoader.h"
 #include "NetworkLoadMetrics.h"
+#include "NetworkStorageSession.h"
 #include "com_sun_webkit_LoadListenerClient.h"
 #include "com_sun_webkit_network_URLLoaderBase.h"
 #include <wtf/CompletionHandler.h>
+#include <wtf/MallocPtr.h>
 
 namespace WebCore {
 class Page;
@@ -127,6 +129,35 @@ std::unique_ptr<URLLoader> URLLoader::loadAsynchronously(NetworkingContext* cont
 {
     std::unique_ptr<URLLoader> result = std::unique_ptr<URLLoader>(new URLLoader());
     result->m_target = std::unique_ptr<AsynchronousTarget>(new AsynchronousTarget(handle));
+
+    auto& cache = HTTPDiskCacheJava::singleton();
+    auto* storageSession = context && context->isValid() ? context->storageSession() : nullptr;
+    if (storageSession && !storageSession->sessionID().isEphemeral()
+        && request.url().protocolIsInHTTPFamily() && cache.isEnabled()) {
+        std::unique_ptr<HTTPDiskCacheJava::Entry> entry;
+        if (HTTPDiskCacheJava::canRetrieve(request))
+            entry = cache.retrieve(request, storageSession);
+        switch (entry ? HTTPDiskCacheJava::useDecision(request, *entry) : HTTPDiskCacheJava::UseDecision::NoUse) {
+        case HTTPDiskCacheJava::UseDecision::Use:
+            result->m_target->loadFromCache(WTFMove(entry));
+            return result;
+        case HTTPDiskCacheJava::UseDecision::Validate: {
+            ResourceRequest conditionalRequest = request;
+            HTTPDiskCacheJava::makeConditional(conditionalRequest, *entry);
+            result->m_target->validateCacheEntry(request, WTFMove(entry));
+            result->m_ref = load(
+                    true,
+                    context,
+                    conditionalRequest,
+                    result->m_target.get());
+            return result;
+        }
+        case HTTPDiskCacheJava::UseDecision::NoUse:
+            result->m_target->recordForCache(request);
+            break;
+        }
+    }
+
     result->m_ref = load(
             true,
             context,
@@ -271,7 +302,56 @@ URLLoader::Target::~Target()
 
 URLLoader::AsynchronousTarget::AsynchronousTarget(ResourceHandle* handle)
     : m_handle(handle)
+    , m_cacheTimer(*this, &AsynchronousTarget::cacheTimerFired)
+{
+}
+
+// Hands a cache entry to the client of the handle. The client may cancel
+// the load from any of its callbacks, which destroys the URLLoader with
+// its target and so the entry must not be owned by the target. Returns
+// whether the load is still alive.
+static bool didReceiveCacheEntry(ResourceHandle& handle, const HTTPDiskCacheJava::Entry& entry)
+{
+    if (auto* client = handle.client()) {
+        client->didReceiveResponseAsync(&handle, ResourceResponse(entry.response), [] () {});
+    }
+    if (!entry.body->isEmpty()) {
+        if (auto* client = handle.client()) {
+            client->didReceiveBuffer(&handle, entry.body.get(), entry.body->size());
+        }
+    }
+    return handle.client();
+}
+
+void URLLoader::AsynchronousTarget::loadFromCache(std::unique_ptr<HTTPDiskCacheJava::Entry> entry)
+{
+    // The response is delivered from a timer, the client does not expect
+    // callbacks before the load has started.
+    m_cacheEntry = WTFMove(entry);
+    m_cacheTimer.startOneShot(0_s);
+}
+
+void URLLoader::AsynchronousTarget::cacheTimerFired()
+{
+    Ref<ResourceHandle> handle(*m_handle);
+    auto entry = WTFMove(m_cacheEntry);
+    if (didReceiveCacheEntry(handle, *entry)) {
+        handle->client()->didFinishLoading(handle.ptr(), {});
+    }
+}
+
+void URLLoader::AsynchronousTarget::validateCacheEntry(const ResourceRequest& request,
+                                                       std::unique_ptr<HTTPDiskCacheJava::Entry> entry)
+{
+    m_cacheRequest = request;
+    m_cacheEntry = WTFMove(entry);
+    m_recordsForCache = true;
+}
+
+void URLLoader::AsynchronousTarget::recordForCache(const ResourceRequest& request)
 {
+    m_cacheRequest = request;
+    m_recordsForCache = true;
 }
 
 void URLLoader::AsynchronousTarget::didSendData(long totalBytesSent,
@@ -293,6 +373,29 @@ bool URLLoader::AsynchronousTarget::willSendRequest(const ResourceResponse& resp
 void URLLoader::AsynchronousTarget::didReceiveResponse(
         const ResourceResponse& response)
 {
+    if (m_recordsForCache) {
+        auto& cache = HTTPDiskCacheJava::singleton();
+        if (m_cacheEntry && response.httpStatusCode() == 304) {
+            // The rest of the validating response is ignored, the body
+            // comes from the cache.
+            m_recordsForCache = false;
+            m_validatedCacheEntry = true;
+            auto entry = WTFMove(m_cacheEntry);
+            cache.update(m_cacheRequest, *entry, response);
+            entry->response.setSource(ResourceResponse::Source::DiskCacheAfterValidation);
+            Ref<ResourceHandle> handle(*m_handle);
+            didReceiveCacheEntry(handle, *entry);
+            return;
+        }
+        m_cacheEntry = nullptr;
+        m_recordsForCache = HTTPDiskCacheJava::canStore(m_cacheRequest, response);
+        if (m_recordsForCache) {
+            m_responseToStore = response;
+        } else {
+            cache.remove(m_cacheRequest);
+        }
+    }
+
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didReceiveResponseAsync(m_handle, ResourceResponse(response), [] () {});
@@ -301,6 +404,18 @@ void URLLoader::AsynchronousTarget::didReceiveResponse(
 
 void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer* data, int length)
 {
+    if (m_validatedCacheEntry) {
+        return;
+    }
+    if (m_recordsForCache) {
+        if (m_bodyToStore.size() + length > HTTPDiskCacheJava::singleton().maximumEntrySize()) {
+            m_recordsForCache = false;
+            m_bodyToStore.reset();
+        } else {
+            m_bodyToStore.append(*data);
+        }
+    }
+
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didReceiveData(m_handle, *data, length);
@@ -309,6 +424,16 @@ void URLLoader::AsynchronousTarget::didReceiveData(const SharedBuffer* data, int
 
 void URLLoader::AsynchronousTarget::didFinishLoading()
 {
+    if (m_recordsForCache) {
+        m_recordsForCache = false;
+        auto* context = m_handle->context();
+        HTTPDiskCacheJava::singleton().store(
+                m_cacheRequest,
+                m_responseToStore,
+                context && context->isValid() ? context->storageSession() : nullptr,
+                m_bodyToStore.take());
+    }
+
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didFinishLoading(m_handle, {});
@@ -317,6 +442,9 @@ void URLLoader::AsynchronousTarget::didFinishLoading()
 
 void URLLoader::AsynchronousTarget::didFail(const ResourceError& error)
 {
+    m_recordsForCache = false;
+    m_bodyToStore.reset();
+
     ResourceHandleClient* client = m_handle->client();
     if (client) {
         client->didFail(m_handle, error);
@@ -498,19 +626,51 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveRe
     target->didReceiveResponse(response);
 }
 
-JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveData
-  (JNIEnv* env, jclass, jobject byteBuffer, jint position, jint remaining,
-   jlong data)
+// Takes over a segment allocated by twkAllocateSegment. Segments that are
+// mostly unused are copied instead, so that a small resource does not keep
+// the whole segment alive for as long as it is cached.
+static Ref<WebCore::SharedBuffer> adoptSegment(uint8_t* segment,
+                                              size_t length,
+                                              size_t capacity)
+{
+    using namespace WebCore;
+    if (length < capacity / 2) {
+        Ref<SharedBuffer> buffer = SharedBuffer::create(segment, length);
+        fastFree(segment);
+        return buffer;
+    }
+    return SharedBuffer::create(DataSegment::Provider {
+        [segment = adoptMallocPtr<uint8_t, FastMalloc>(segment)]() -> const uint8_t* { return segment.get(); },
+        [length]() { return length; }
+    });
+}
+
+JNIEXPORT jobject JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkAllocateSegment
+  (JNIEnv* env, jclass, jint capacity)
+{
+    ASSERT(capacity > 0);
+    return env->NewDirectByteBuffer(fastMalloc(capacity), capacity);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkFreeSegment
+  (JNIEnv* env, jclass, jobject segment)
+{
+    fastFree(env->GetDirectBufferAddress(segment));
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveSegment
+  (JNIEnv* env, jclass, jobject segment, jint length, jlong data)
 {
     using namespace WebCore;
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
-    const uint8_t* address =
-            static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<FragmentedSharedBuffer> tmp_buf = FragmentedSharedBuffer::create(address,remaining);
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    uint8_t* address =
+            static_cast<uint8_t*>(env->GetDirectBufferAddress(segment));
+    size_t capacity = static_cast<size_t>(env->GetDirectBufferCapacity(segment));
+    ASSERT(length >= 0 && static_cast<size_t>(length) <= capacity);
+    Ref<SharedBuffer> buffer = adoptSegment(address, length, capacity);
+    target->didReceiveData(buffer.ptr(), length);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
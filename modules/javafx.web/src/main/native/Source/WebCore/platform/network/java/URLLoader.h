@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,9 @@
 
 #pragma once
 
+#include "HTTPDiskCacheJava.h"
+#include "ResourceRequest.h"
+#include "Timer.h"
 #include <wtf/java/JavaRef.h>
 #include <wtf/Vector.h>
 #include <wtf/text/WTFString.h>
@@ -82,8 +85,21 @@ private:
         void didReceiveData(const SharedBuffer* data, int length) final;
         void didFinishLoading() final;
         void didFail(const ResourceError& error) final;
+
+        void loadFromCache(std::unique_ptr<HTTPDiskCacheJava::Entry>);
+        void validateCacheEntry(const ResourceRequest&, std::unique_ptr<HTTPDiskCacheJava::Entry>);
+        void recordForCache(const ResourceRequest&);
     private:
+        void cacheTimerFired();
+
         ResourceHandle* m_handle;
+        Timer m_cacheTimer;
+        ResourceRequest m_cacheRequest;
+        std::unique_ptr<HTTPDiskCacheJava::Entry> m_cacheEntry;
+        ResourceResponse m_responseToStore;
+        SharedBufferBuilder m_bodyToStore;
+        bool m_recordsForCache { false };
+        bool m_validatedCacheEntry { false };
     };
 
     class SynchronousTarget : public Target {
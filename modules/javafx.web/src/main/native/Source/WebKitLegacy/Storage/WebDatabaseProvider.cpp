@@ -42,12 +42,14 @@ WebDatabaseProvider::~WebDatabaseProvider()
 {
 }
 
+#if !PLATFORM(JAVA)
 WebCore::IDBClient::IDBConnectionToServer& WebDatabaseProvider::idbConnectionToServerForSession(PAL::SessionID sessionID)
 {
     return m_idbServerMap.ensure(sessionID, [&sessionID] {
         return sessionID.isEphemeral() ? InProcessIDBServer::create(sessionID) : InProcessIDBServer::create(sessionID, indexedDatabaseDirectoryPath());
     }).iterator->value->connectionToServer();
 }
+#endif
 
 void WebDatabaseProvider::deleteAllDatabases()
 {
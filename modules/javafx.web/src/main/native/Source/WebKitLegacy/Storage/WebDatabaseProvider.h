@@ -41,10 +41,19 @@ public:
 
     void deleteAllDatabases();
 
+#if PLATFORM(JAVA)
+    static Ref<WebDatabaseProvider> create();
+    void setIndexedDatabaseDirectoryPath(const String&);
+#endif
+
 private:
     explicit WebDatabaseProvider();
 
+#if PLATFORM(JAVA)
+    String m_indexedDatabaseDirectoryPath;
+#else
     static String indexedDatabaseDirectoryPath();
+#endif
 
     HashMap<PAL::SessionID, RefPtr<InProcessIDBServer>> m_idbServerMap;
 };
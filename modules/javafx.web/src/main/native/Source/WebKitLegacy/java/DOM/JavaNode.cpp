@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -37,6 +37,8 @@
 #include <WebCore/NamedNodeMap.h>
 #include <WebCore/Node.h>
 #include <WebCore/NodeList.h>
+#include <WebCore/NodeTraversal.h>
+#include <WebCore/RenderObject.h>
 #include <WebCore/JSExecState.h>
 #include <WebCore/SVGTests.h>
 #include <JavaScriptCore/APICast.h>
@@ -48,6 +50,100 @@
 
 using namespace WebCore;
 
+namespace {
+
+// Serializes a subtree for com.sun.webkit.dom.NodeSnapshot, which documents
+// the format. Values are written in native byte order.
+class NodeSnapshotWriter {
+public:
+    explicit NodeSnapshotWriter(bool includeLayout)
+        : m_includeLayout(includeLayout)
+    {
+        append<uint8_t>(includeLayout ? 1 : 0);
+    }
+
+    void appendSubtree(Node& root)
+    {
+        if (m_includeLayout)
+            root.document().updateLayoutIgnorePendingStylesheets();
+        for (Node* node = &root; node; node = NodeTraversal::next(*node, &root))
+            appendNode(*node);
+    }
+
+    jbyteArray toJavaArray(JNIEnv* env) const
+    {
+        jbyteArray array = env->NewByteArray(m_buffer.size());
+        if (!array)
+            return nullptr;
+        env->SetByteArrayRegion(array, 0, m_buffer.size(), reinterpret_cast<const jbyte*>(m_buffer.data()));
+        return array;
+    }
+
+private:
+    template<typename T> void append(T value)
+    {
+        m_buffer.append(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+    }
+
+    void append(const String& string)
+    {
+        if (string.isNull()) {
+            append<int32_t>(-1);
+            return;
+        }
+        append<int32_t>(string.length());
+        if (string.is8Bit()) {
+            for (auto character : string.span8())
+                append<UChar>(character);
+        } else
+            m_buffer.append(reinterpret_cast<const uint8_t*>(string.characters16()), string.length() * sizeof(UChar));
+    }
+
+    void appendNode(Node& node)
+    {
+        append<uint16_t>(node.nodeType());
+        append<uint32_t>(node.countChildNodes());
+        append(node.nodeName());
+        append(node.nodeValue());
+
+        auto* element = dynamicDowncast<Element>(node);
+        if (element && element->hasAttributes()) {
+            append<uint32_t>(element->attributeCount());
+            for (const Attribute& attribute : element->attributesIterator()) {
+                append(attribute.name().toString());
+                append(attribute.value().string());
+            }
+        } else
+            append<uint32_t>(0);
+
+        if (!m_includeLayout)
+            return;
+        auto* renderer = node.renderer();
+        append<uint8_t>(renderer ? 1 : 0);
+        if (renderer) {
+            IntRect box = renderer->absoluteBoundingBoxRect();
+            append<float>(box.x());
+            append<float>(box.y());
+            append<float>(box.width());
+            append<float>(box.height());
+        }
+    }
+
+    Vector<uint8_t> m_buffer;
+    bool m_includeLayout;
+};
+
+// Must match the operation codes in com.sun.webkit.dom.NodeMutationBatch.
+enum class NodeMutation : jbyte {
+    SetAttribute,
+    RemoveAttribute,
+    SetTextContent,
+    AppendChild,
+    Remove,
+};
+
+} // namespace
+
 extern "C" {
 
 #define IMPL (static_cast<Node*>(jlong_to_ptr(peer)))
@@ -354,4 +450,62 @@ JNIEXPORT jboolean JNICALL Java_com_sun_webkit_dom_NodeImpl_dispatchEventImpl(JN
 }
 
 
+// Snapshots and batched mutations
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_dom_NodeImpl_snapshotImpl(JNIEnv* env, jclass, jlong peer
+    , jboolean includeLayout)
+{
+    WebCore::JSMainThreadNullState state;
+    NodeSnapshotWriter writer(jbool_to_bool(includeLayout));
+    writer.appendSubtree(*IMPL);
+    return writer.toJavaArray(env);
+}
+
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_dom_NodeMutationBatch_applyImpl(JNIEnv* env, jclass
+    , jbyteArray operations
+    , jlongArray targets
+    , jlongArray nodes
+    , jobjectArray names
+    , jobjectArray values)
+{
+    WebCore::JSMainThreadNullState state;
+    jsize count = env->GetArrayLength(operations);
+    Vector<jbyte> operationCodes(count);
+    Vector<jlong> targetPeers(count);
+    Vector<jlong> nodePeers(count);
+    env->GetByteArrayRegion(operations, 0, count, operationCodes.data());
+    env->GetLongArrayRegion(targets, 0, count, targetPeers.data());
+    env->GetLongArrayRegion(nodes, 0, count, nodePeers.data());
+
+    for (jsize i = 0; i < count; i++) {
+        Node* target = jlong_to_Nodeptr(targetPeers[i]);
+        JLString name(static_cast<jstring>(env->GetObjectArrayElement(names, i)));
+        JLString value(static_cast<jstring>(env->GetObjectArrayElement(values, i)));
+        switch (static_cast<NodeMutation>(operationCodes[i])) {
+        case NodeMutation::SetAttribute:
+            raiseOnDOMError(env, downcast<Element>(*target).setAttribute(AtomString {String(env, name)}, AtomString {String(env, value)}));
+            break;
+        case NodeMutation::RemoveAttribute:
+            downcast<Element>(*target).removeAttribute(AtomString {String(env, name)});
+            break;
+        case NodeMutation::SetTextContent:
+            target->setTextContent(String(env, value));
+            break;
+        case NodeMutation::AppendChild:
+            raiseOnDOMError(env, target->appendChild(*jlong_to_Nodeptr(nodePeers[i])));
+            break;
+        case NodeMutation::Remove:
+            raiseOnDOMError(env, target->remove());
+            break;
+        default:
+            raiseNotSupportedErrorException(env);
+            break;
+        }
+        // Stop at the first failure, leaving earlier mutations applied.
+        if (env->ExceptionCheck())
+            return;
+    }
+}
+
+
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -97,6 +97,9 @@
 #include <WebCore/RenderTreeAsText.h>
 #include <WebCore/RenderView.h>
 #include <WebCore/ResourceRequest.h>
+#include <WebCore/SQLiteIDBBackingStore.h>
+#include <WebCore/RunLoopObserver.h>
+#include <WebCore/ScriptBytecodeCacheJava.h>
 #include <WebCore/ScriptController.h>
 #include <WebCore/SecurityPolicy.h>
 #include <WebCore/Settings.h>
@@ -106,6 +109,7 @@
 #include <WebCore/TextureMapperLayer.h>
 #include <WebCore/WorkerThread.h>
 #include <WebCore/platform/graphics/java/GraphicsContextJava.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/Ref.h>
 #include <wtf/RunLoop.h>
 #include <wtf/java/JavaRef.h>
@@ -221,7 +225,7 @@ static void drawDebugBorder(GraphicsContext& context,
     context.fillRect(FloatRect(x + w - width, y, width, h), color);
 }
 
-void WebPage::prePaint() {
+void WebPage::prePaint(bool fullRepaint) {
     if (m_rootLayer) {
         if (m_syncLayers) {
             m_syncLayers = false;
@@ -230,6 +234,8 @@ void WebPage::prePaint() {
         return;
     }
 
+    Region damage = std::exchange(m_damage, { });
+
     Frame* mainFrame = (Frame*)&m_page->mainFrame();
         auto* localFrame = dynamicDowncast<LocalFrame>(mainFrame);
     LocalFrameView* frameView = localFrame->view();
@@ -237,6 +243,16 @@ void WebPage::prePaint() {
         // Updating layout & styles precedes normal painting.
         frameView->updateLayoutAndStyleIfNeededRecursive();
     }
+
+    // The rects invalidated by the layout are painted in this frame and
+    // are kept for the next one since java has already requested them
+    // in a new list of dirty rects.
+    damage.unite(m_damage);
+    if (fullRepaint) {
+        m_frameDamage = std::nullopt;
+    } else {
+        m_frameDamage = WTFMove(damage);
+    }
 }
 
 RefPtr<RQRef> WebPage::jRenderTheme()
@@ -272,9 +288,24 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
     JSGlobalContextRef globalContext = toGlobalRef(localFrame->script().globalObject(mainThreadNormalWorld()));
     JSC::JSLockHolder sw(toJS(globalContext)); // TODO-java: was JSC::APIEntryShim sw( toJS(globalContext) );
 
-    frameView->paint(gc, IntRect(x, y, w, h));
+    IntRect rect(x, y, w, h);
+    if (m_frameDamage) {
+        Region damage = intersect(*m_frameDamage, Region(rect));
+        auto rects = damage.rects();
+        if (rects.size() > maxDamageRects) {
+            rects = { damage.bounds() };
+        }
+        for (const auto& damageRect : rects) {
+            gc.save();
+            gc.clip(FloatRect(damageRect));
+            frameView->paint(gc, damageRect);
+            gc.restore();
+        }
+    } else {
+        frameView->paint(gc, rect);
+    }
     if (m_page->settings().showDebugBorders()) {
-        drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 0, 255, 128 });
+        drawDebugLed(gc, rect, SRGBA<uint8_t> { 0, 0, 255, 128 });
     }
 
     gc.platformContext()->rq().flushBuffer();
@@ -282,6 +313,10 @@ void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 
 void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
 {
+    // The frame is complete, any following paint request is not limited
+    // to the damage (e.g. printing).
+    m_frameDamage = std::nullopt;
+
     if (!m_page->inspectorController().highlightedNode()
             && !m_rootLayer
     ) {
@@ -322,6 +357,10 @@ void WebPage::scroll(const IntSize& scrollDelta,
         return;
     }
 
+    // The damage collected so far is moved along with the content
+    // and java repaints the exposed area, so the whole rect is damaged.
+    m_damage.unite(rectToScroll);
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID mid = env->GetMethodID(
@@ -346,6 +385,8 @@ void WebPage::repaint(const IntRect& rect)
 {
     if (m_rootLayer) {
         m_rootLayer->setNeedsDisplayInRect(rect);
+    } else {
+        m_damage.unite(rect);
     }
     requestJavaRepaint(rect);
 }
@@ -384,6 +425,8 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
     } else {
         m_rootLayer = nullptr;
         m_textureMapper.reset();
+        // The damage was not tracked while compositing.
+        m_damage.unite(pageRect());
     }
 }
 
@@ -860,6 +903,7 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
 bool s_useCSS3D;
 
 }  // namespace
@@ -867,9 +911,10 @@ bool s_useCSS3D;
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT, jboolean useCSS3D) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
     s_useCSS3D = useCSS3D;
 }
 
@@ -899,6 +944,10 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+#if ENABLE(FTL_JIT)
+        // FTL tiers up from DFG, so it needs DFG as well.
+        JSC::Options::useFTLJIT() = s_useJIT && s_useDFGJIT && s_useFTLJIT;
+#endif
     });
 
     JLObject jlself(self, true);
@@ -913,7 +962,7 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
     pc.editorClient = makeUniqueRef<EditorClientJava>(jlself);
     pc.dragClient = makeUnique<DragClientJava>(jlself);
     pc.inspectorClient = makeUnique<InspectorClientJava>(jlself);
-    pc.databaseProvider = &WebDatabaseProvider::singleton();
+    pc.databaseProvider = WebDatabaseProvider::create();
     pc.storageNamespaceProvider = adoptRef(new WebStorageNamespaceProviderJava());
     pc.visitedLinkStore = VisitedLinkStoreJava::create();
 
@@ -963,6 +1012,8 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInit
     page->setDeviceScaleFactor(devicePixelScale);
 
     settings.setLinkPrefetchEnabled(true);
+    settings.setImageSubsamplingEnabled(true);
+    settings.setLargeImageAsyncDecodingEnabled(true);
 
         Frame* mainFrame = (Frame*)&page->mainFrame();
     auto* frame = dynamicDowncast<LocalFrame>(mainFrame);
@@ -993,6 +1044,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDestroyPage
         mainFrame->loader().detachFromParent();
     }
 
+    // Scripts of the page may stay alive until the next collection.
+    ScriptBytecodeCacheJava::singleton().storePendingBytecode();
+
     delete webPage;
 }
 
@@ -1724,9 +1778,9 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBackgroundColor
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkPrePaint
-  (JNIEnv*, jobject, jlong pPage)
+  (JNIEnv*, jobject, jlong pPage, jboolean fullRepaint)
 {
-    WebPage::webPageFromJLong(pPage)->prePaint();
+    WebPage::webPageFromJLong(pPage)->prePaint(jbool_to_bool(fullRepaint));
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkUpdateContent
@@ -2492,6 +2546,23 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageDatabasePat
         ->setLocalStorageDatabasePath(settings.localStorageDatabasePath());
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetIndexedDatabaseDirectory
+  (JNIEnv* env, jobject, jlong pPage, jstring path, jlong pageCacheSize)
+{
+    ASSERT(pPage);
+    Page* page = WebPage::pageFromJLong(pPage);
+    ASSERT(page);
+    static_cast<WebDatabaseProvider&>(page->databaseProvider())
+        .setIndexedDatabaseDirectoryPath(String(env, path));
+    IDBServer::SQLiteIDBBackingStore::setPageCacheSize(pageCacheSize > 0 ? pageCacheSize : 0);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCacheDirectory
+  (JNIEnv* env, jclass, jstring path)
+{
+    ScriptBytecodeCacheJava::singleton().setDirectory(String(env, path));
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
   (JNIEnv*, jobject, jlong pPage, jboolean enabled)
 {
@@ -2589,4 +2660,73 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDoJSCGarbageCollection
     GCController::singleton().garbageCollectNow();
 }
 
+JNIEXPORT jint JNICALL Java_com_sun_webkit_WebPage_twkGetBytecodeCacheRetrievedCount
+  (JNIEnv*, jclass)
+{
+    return ScriptBytecodeCacheJava::singleton().retrievedCount();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkDeleteAllJSCode
+  (JNIEnv*, jclass)
+{
+    GCController::singleton().deleteAllCode(JSC::DeleteAllCodeIfNotCollecting);
+}
+
+// Main RunLoop timers and observers started by twkStartRunLoopTest, and
+// how often they fired.
+struct RunLoopTest {
+    std::unique_ptr<RunLoop::Timer> oneShotTimer;
+    std::unique_ptr<RunLoop::Timer> repeatingTimer;
+    std::unique_ptr<RunLoopObserver> observer;
+    jint oneShotFired { 0 };
+    jint repeatingFired { 0 };
+    jint observerFired { 0 };
+    bool firedOnMainThread { true };
+};
+
+static RunLoopTest& runLoopTest()
+{
+    static NeverDestroyed<RunLoopTest> test;
+    return test;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkStartRunLoopTest
+  (JNIEnv*, jclass, jint repeatCount)
+{
+    auto& test = runLoopTest();
+    test = { };
+
+    auto fired = [](jint& count) {
+        runLoopTest().firedOnMainThread &= isMainThread();
+        ++count;
+    };
+    test.oneShotTimer = makeUnique<RunLoop::Timer>(RunLoop::main(), [fired] {
+        fired(runLoopTest().oneShotFired);
+    });
+    test.oneShotTimer->startOneShot(10_ms);
+    test.repeatingTimer = makeUnique<RunLoop::Timer>(RunLoop::main(), [fired, repeatCount] {
+        auto& test = runLoopTest();
+        fired(test.repeatingFired);
+        if (test.repeatingFired == repeatCount)
+            test.repeatingTimer->stop();
+    });
+    test.repeatingTimer->startRepeating(10_ms);
+    test.observer = makeUnique<RunLoopObserver>(RunLoopObserver::WellKnownOrder::PostRenderingUpdate, [fired] {
+        fired(runLoopTest().observerFired);
+    }, RunLoopObserver::Type::OneShot);
+    test.observer->schedule();
+}
+
+JNIEXPORT jintArray JNICALL Java_com_sun_webkit_WebPage_twkGetRunLoopTestResults
+  (JNIEnv* env, jclass)
+{
+    auto& test = runLoopTest();
+    jint results[] = { test.oneShotFired, test.repeatingFired, test.observerFired, test.firedOnMainThread };
+    jintArray jresults = env->NewIntArray(std::size(results));
+    if (jresults && !WTF::CheckAndClearException(env)) {
+        env->SetIntArrayRegion(jresults, 0, std::size(results), results);
+    }
+    return jresults;
+}
+
 }
@@ -30,6 +30,7 @@
 #include <WebCore/GraphicsLayerClient.h>
 #include <WebCore/IntRect.h>
 #include <WebCore/PrintContext.h>
+#include <WebCore/Region.h>
 #include <WebCore/ScrollTypes.h>
 
 #include "MediaPlayerPrivateJava.h"
@@ -82,7 +83,7 @@ public:
     static JLObject jobjectFromPage(Page* page);
 
     void setSize(const IntSize&);
-    void prePaint();
+    void prePaint(bool fullRepaint);
     void paint(jobject, jint, jint, jint, jint);
     void postPaint(jobject, jint, jint, jint, jint);
     bool processKeyEvent(const PlatformKeyboardEvent& event);
@@ -135,6 +136,15 @@ private:
     std::unique_ptr<TextureMapper> m_textureMapper;
     bool m_syncLayers { false };
 
+    // Areas invalidated since the last prePaint(). Java requests a repaint
+    // of a union of the invalidated rects, so the painting is limited to
+    // the damage actually reported within the requested rect.
+    Region m_damage;
+    // The damage to be painted in the current frame, unset when the whole
+    // requested rect should be painted (full repaint, printing).
+    std::optional<Region> m_frameDamage;
+    static const size_t maxDamageRects = 16;
+
     // Webkit expects keyPress events to be suppressed if the associated keyDown
     // event was handled. Safari implements this behavior by peeking out the
     // associated WM_CHAR event if the keydown was handled. We emulate
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,7 +25,41 @@
 
 #include "WebDatabaseProvider.h"
 
-String WebDatabaseProvider::indexedDatabaseDirectoryPath()
+#include <pal/SessionID.h>
+#include <wtf/HashMap.h>
+#include <wtf/MainThread.h>
+#include <wtf/NeverDestroyed.h>
+
+// Every page has a provider of its own, since the IndexedDB directory
+// comes from the user data directory of its WebEngine.
+Ref<WebDatabaseProvider> WebDatabaseProvider::create()
+{
+    return adoptRef(*new WebDatabaseProvider);
+}
+
+// The IDB connection of a page is created when the page first uses
+// IndexedDB, so a new directory only applies to pages that have not.
+// Without a directory the databases are kept in memory.
+void WebDatabaseProvider::setIndexedDatabaseDirectoryPath(const String& path)
 {
-    return ""_s;
+    ASSERT(isMainThread());
+    m_indexedDatabaseDirectoryPath = path;
+}
+
+WebCore::IDBClient::IDBConnectionToServer& WebDatabaseProvider::idbConnectionToServerForSession(PAL::SessionID sessionID)
+{
+    ASSERT(isMainThread());
+    if (sessionID.isEphemeral()) {
+        return m_idbServerMap.ensure(sessionID, [&sessionID] {
+            return InProcessIDBServer::create(sessionID);
+        }).iterator->value->connectionToServer();
+    }
+
+    // The pages that use the same directory share its server, so that
+    // a database is never opened by two servers at once.
+    static NeverDestroyed<HashMap<String, RefPtr<InProcessIDBServer>>> servers;
+    String directory = m_indexedDatabaseDirectoryPath.isNull() ? emptyString() : m_indexedDatabaseDirectoryPath;
+    return servers->ensure(directory, [&] {
+        return InProcessIDBServer::create(sessionID, directory);
+    }).iterator->value->connectionToServer();
 }
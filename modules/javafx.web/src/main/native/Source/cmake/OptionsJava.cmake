@@ -43,6 +43,22 @@ find_package(JNI REQUIRED)
 find_package(Threads REQUIRED)
 # find_package(ZLIB REQUIRED)
 
+# SubtleCrypto and CryptoDigest can use the system libcrypto on Linux.
+# This is opt-in, so that the library does not depend on what happens to be
+# installed on the build host; without it, digesting goes through
+# java.security.MessageDigest and SubtleCrypto is not available.
+option(USE_SYSTEM_OPENSSL "Use the system libcrypto for SubtleCrypto and CryptoDigest (Linux only)" OFF)
+if (USE_SYSTEM_OPENSSL)
+    if (NOT UNIX OR APPLE)
+        message(FATAL_ERROR "USE_SYSTEM_OPENSSL is only supported on Linux")
+    endif ()
+    find_package(OpenSSL 1.1.1)
+    if (NOT OPENSSL_FOUND)
+        message(FATAL_ERROR "USE_SYSTEM_OPENSSL is enabled but OpenSSL 1.1.1 or later was not found")
+    endif ()
+    SET_AND_EXPOSE_TO_BUILD(USE_OPENSSL ON)
+endif ()
+
 if (APPLE)
     add_definitions(-DUSE_CF=1)
     add_definitions(-DJSC_OBJC_API_ENABLED=0)
@@ -122,6 +138,19 @@ if (WIN32)
     endif ()
 endif ()
 
+if (USE_OPENSSL)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEB_CRYPTO PRIVATE ON)
+endif ()
+
+# WebAssembly's BBQ and OMG tiers are built on B3, which is only enabled
+# along with the FTL.
+if (UNIX AND NOT APPLE AND WTF_CPU_X86_64)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_FTL_JIT PUBLIC ON)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY PRIVATE ON)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY_B3JIT PRIVATE ON)
+    WEBKIT_OPTION_DEFAULT_PORT_VALUE(ENABLE_WEBASSEMBLY_BBQJIT PRIVATE ON)
+endif ()
+
 
 # Finalize the value for all options. Do not attempt to use an option before
 # this point, and do not attempt to change any option after this point.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,14 +23,10 @@
  * questions.
  */
 
-package com.sun.webkit.graphics;
+package com.sun.javafx.webkit.prism;
 
-public interface WCTextRun {
-    boolean isLeftToRight();
-    float[] getGlyphPosAndAdvance(int glyphIndex);
-    int getCharOffset(int index);
-    int getEnd();
-    int getGlyph(int index);
-    int getGlyphCount();
-    int getStart();
+public final class WCImageDecoderImplShim {
+    public static int getLastSubsampledWidth() {
+        return WCImageDecoderImpl.getLastSubsampledWidth();
+    }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,29 @@ public class WebPageShim {
         return page.test_getFramesCount();
     }
 
+    public static int getBytecodeCacheRetrievedCount() {
+        return WebPage.test_getBytecodeCacheRetrievedCount();
+    }
+
+    // Drops the bytecode the VM keeps in memory, so that scripts are looked
+    // up in the bytecode cache again.
+    public static void deleteAllJSCode() {
+        WebPage.test_deleteAllJSCode();
+    }
+
+    // Starts a one-shot and a repeating timer on the main RunLoop and a
+    // one-shot RunLoopObserver. The repeating timer stops itself after
+    // repeatCount firings. Must be called on the FX thread.
+    public static void startRunLoopTest(int repeatCount) {
+        WebPage.test_startRunLoopTest(repeatCount);
+    }
+
+    // Returns how often the one-shot timer, the repeating timer and the
+    // observer fired, and 1 if all of them fired on the main thread.
+    public static int[] getRunLoopTestResults() {
+        return WebPage.test_getRunLoopTestResults();
+    }
+
     private static WCGraphicsContext setupPageWithGraphics(WebPage page, int x, int y, int w, int h) {
         page.setBounds(x, y, w, h);
         // forces layout and renders the page into RenderQueue.
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.network;
+
+import java.net.InetAddress;
+import java.net.UnknownHostException;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class DNSResolverShim {
+
+    private static final AtomicInteger lookupCount = new AtomicInteger();
+    private static volatile CountDownLatch lookupGate;
+
+    /**
+     * Makes the resolver look names up in the given lines in the format
+     * of /etc/hosts instead of the system resolver.
+     */
+    public static void setHosts(String hosts, long ttl, long negativeTtl, TimeUnit unit)
+            throws UnknownHostException
+    {
+        Map<String, List<InetAddress>> table = new HashMap<>();
+        for (String line : hosts.split("\n")) {
+            int comment = line.indexOf('#');
+            String[] fields = (comment >= 0 ? line.substring(0, comment) : line)
+                    .trim().split("\\s+");
+            for (int i = 1; i < fields.length; i++) {
+                // Address literals are parsed without any lookup
+                table.computeIfAbsent(fields[i], k -> new ArrayList<>())
+                        .add(InetAddress.getByAddress(fields[i],
+                                InetAddress.getByName(fields[0]).getAddress()));
+            }
+        }
+        lookupCount.set(0);
+        DNSResolver.setResolver(host -> {
+            lookupCount.incrementAndGet();
+            CountDownLatch gate = lookupGate;
+            if (gate != null) {
+                try {
+                    gate.await(5, TimeUnit.SECONDS);
+                } catch (InterruptedException ex) {
+                    throw new RuntimeException(ex);
+                }
+            }
+            List<InetAddress> addresses = table.get(host);
+            if (addresses == null) {
+                throw new UnknownHostException(host);
+            }
+            return addresses.toArray(new InetAddress[0]);
+        }, ttl, negativeTtl, unit);
+    }
+
+    public static void reset() {
+        releaseLookups();
+        DNSResolver.resetResolver();
+    }
+
+    /**
+     * Makes lookups wait until {@link #releaseLookups} is called.
+     */
+    public static void holdLookups() {
+        lookupGate = new CountDownLatch(1);
+    }
+
+    public static void releaseLookups() {
+        CountDownLatch gate = lookupGate;
+        lookupGate = null;
+        if (gate != null) {
+            gate.countDown();
+        }
+    }
+
+    public static int getLookupCount() {
+        return lookupCount.get();
+    }
+
+    public static InetAddress[] resolve(String host) throws Exception {
+        return DNSResolver.resolve(host).get(5, TimeUnit.SECONDS);
+    }
+
+    public static CompletableFuture<InetAddress[]> resolveAsync(String host) {
+        return DNSResolver.resolve(host);
+    }
+}
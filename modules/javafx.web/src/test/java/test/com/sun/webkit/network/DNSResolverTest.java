@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.com.sun.webkit.network;
+
+import com.sun.webkit.network.DNSResolverShim;
+import java.net.InetAddress;
+import java.net.UnknownHostException;
+import java.util.List;
+import java.util.Queue;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.CopyOnWriteArrayList;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.TimeUnit;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertSame;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+/**
+ * A test for the {@link DNSResolver} class, using a hosts file in place
+ * of the system resolver.
+ */
+public class DNSResolverTest {
+
+    private static final String HOSTS =
+            "# Test hosts\n"
+            + "192.0.2.1    one.test\n"
+            + "192.0.2.2    two.test alias.test\n"
+            + "2001:db8::1  two.test\n";
+
+    @Before
+    public void before() throws Exception {
+        DNSResolverShim.setHosts(HOSTS, 1, 1, TimeUnit.HOURS);
+    }
+
+    @After
+    public void after() {
+        DNSResolverShim.reset();
+    }
+
+    /**
+     * Tests that names resolve to the addresses in the hosts file.
+     */
+    @Test
+    public void testResolve() throws Exception {
+        InetAddress[] one = DNSResolverShim.resolve("one.test");
+        assertEquals(1, one.length);
+        assertEquals("192.0.2.1", one[0].getHostAddress());
+
+        InetAddress[] two = DNSResolverShim.resolve("two.test");
+        assertEquals(2, two.length);
+        assertEquals("192.0.2.2", two[0].getHostAddress());
+        assertEquals(16, two[1].getAddress().length);
+
+        assertEquals("192.0.2.2", DNSResolverShim.resolve("alias.test")[0].getHostAddress());
+    }
+
+    /**
+     * Tests that unknown names fail with an UnknownHostException.
+     */
+    @Test
+    public void testUnknownHost() throws Exception {
+        try {
+            DNSResolverShim.resolve("unknown.test");
+            fail("unknown.test resolved");
+        } catch (ExecutionException ex) {
+            assertTrue(ex.getCause() instanceof UnknownHostException);
+        }
+    }
+
+    /**
+     * Tests that successful and failed lookups are cached.
+     */
+    @Test
+    public void testCache() throws Exception {
+        DNSResolverShim.resolve("one.test");
+        DNSResolverShim.resolve("one.test");
+        assertEquals(1, DNSResolverShim.getLookupCount());
+
+        for (int i = 0; i < 2; i++) {
+            try {
+                DNSResolverShim.resolve("unknown.test");
+            } catch (ExecutionException expected) {
+            }
+        }
+        assertEquals(2, DNSResolverShim.getLookupCount());
+    }
+
+    /**
+     * Tests that cached entries expire after their time to live.
+     */
+    @Test
+    public void testExpiration() throws Exception {
+        DNSResolverShim.setHosts(HOSTS, 100, 100, TimeUnit.MILLISECONDS);
+        DNSResolverShim.resolve("one.test");
+        Thread.sleep(200);
+        DNSResolverShim.resolve("one.test");
+        assertEquals(2, DNSResolverShim.getLookupCount());
+    }
+
+    /**
+     * Tests that concurrent requests for a name share one lookup.
+     */
+    @Test
+    public void testConcurrentRequests() throws Exception {
+        // Keep the lookup pending until every thread has made its request,
+        // so that the requests cannot be served from the cache
+        DNSResolverShim.holdLookups();
+        List<CompletableFuture<InetAddress[]>> futures = new CopyOnWriteArrayList<>();
+        Queue<Throwable> failures = new ConcurrentLinkedQueue<>();
+        Thread[] threads = new Thread[8];
+        for (int i = 0; i < threads.length; i++) {
+            threads[i] = new Thread(
+                    () -> futures.add(DNSResolverShim.resolveAsync("two.test")));
+            threads[i].setUncaughtExceptionHandler((t, ex) -> failures.add(ex));
+            threads[i].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        DNSResolverShim.releaseLookups();
+
+        for (Throwable failure : failures) {
+            throw new AssertionError(failure);
+        }
+        assertEquals(threads.length, futures.size());
+        InetAddress[] first = futures.get(0).get(5, TimeUnit.SECONDS);
+        for (CompletableFuture<InetAddress[]> future : futures) {
+            assertSame(first, future.get(5, TimeUnit.SECONDS));
+        }
+        assertEquals(1, DNSResolverShim.getLookupCount());
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package test.javafx.scene.web;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import com.sun.webkit.WebPageShim;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.concurrent.Worker.State;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebEngineShim;
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+public class BytecodeCacheTest extends TestBase {
+
+    private static final File USER_DATA_DIR = new File("build/bytecodecache");
+    private static final File SECOND_USER_DATA_DIR = new File("build/bytecodecache-second");
+    private static final File PAGE_DIR = new File("build/bytecodecache-page");
+    private static final File CACHE_DIR = new File(USER_DATA_DIR, "bytecodecache");
+    private static final int FUNCTION_COUNT = 200;
+
+    private static void deleteRecursively(File file) throws IOException {
+        if (file.isDirectory()) {
+            for (File f : file.listFiles()) {
+                deleteRecursively(f);
+            }
+        }
+
+        if (file.exists() && !file.delete()) {
+            file.deleteOnExit();
+        }
+    }
+
+    @BeforeClass
+    public static void beforeClass() throws IOException {
+        deleteRecursively(USER_DATA_DIR);
+        deleteRecursively(SECOND_USER_DATA_DIR);
+        deleteRecursively(PAGE_DIR);
+        System.setProperty("com.sun.webkit.bytecodeCache", "true");
+
+        // Scripts smaller than 4 KB are not cached.
+        StringBuilder script = new StringBuilder();
+        for (int i = 0; i < FUNCTION_COUNT; i++) {
+            script.append("function f").append(i).append("(x) { return x + ").append(i).append("; }\n");
+        }
+        script.append("function run() { var sum = 0;");
+        for (int i = 0; i < FUNCTION_COUNT; i++) {
+            script.append(" sum = f").append(i).append("(sum);");
+        }
+        script.append(" return sum; }\n");
+        Files.createDirectories(PAGE_DIR.toPath());
+        Files.writeString(new File(PAGE_DIR, "script.js").toPath(), script);
+        Files.writeString(new File(PAGE_DIR, "page.html").toPath(),
+                "<html><head><script src='script.js'></script></head><body></body></html>");
+    }
+
+    @AfterClass
+    public static void afterClass() throws IOException {
+        System.clearProperty("com.sun.webkit.bytecodeCache");
+        deleteRecursively(USER_DATA_DIR);
+        deleteRecursively(SECOND_USER_DATA_DIR);
+        deleteRecursively(PAGE_DIR);
+    }
+
+    private WebEngine loadPage(File userDataDir) throws InterruptedException {
+        final CountDownLatch loaded = new CountDownLatch(1);
+        final WebEngine webEngine = submit(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setUserDataDirectory(userDataDir);
+            engine.getLoadWorker().stateProperty().addListener((observable, oldValue, newValue) -> {
+                if (newValue == State.SUCCEEDED) {
+                    loaded.countDown();
+                }
+            });
+            engine.load(new File(PAGE_DIR, "page.html").toURI().toString());
+            return engine;
+        });
+        assertTrue("Timeout loading the page", loaded.await(10, TimeUnit.SECONDS));
+        return webEngine;
+    }
+
+    // The bytecode is written on a background queue.
+    private static boolean waitForBytecode() throws InterruptedException {
+        for (int i = 0; i < 100; i++) {
+            String[] names = CACHE_DIR.list((dir, name) -> name.endsWith(".bytecode"));
+            if (names != null && names.length > 0) {
+                return true;
+            }
+            Thread.sleep(50);
+        }
+        return false;
+    }
+
+    @Test
+    public void testSecondLoadUsesCachedBytecode() throws Exception {
+        final int expected = FUNCTION_COUNT * (FUNCTION_COUNT - 1) / 2;
+
+        final WebEngine first = loadPage(USER_DATA_DIR);
+        assertEquals(expected, ((Number) submit(() -> first.executeScript("run()"))).intValue());
+        // Destroying the page writes the bytecode of its scripts.
+        submit(() -> WebEngineShim.dispose(first));
+        assertTrue("No bytecode in " + CACHE_DIR, waitForBytecode());
+
+        final int retrievedCount = submit(() -> WebPageShim.getBytecodeCacheRetrievedCount());
+        submit(() -> WebPageShim.deleteAllJSCode());
+
+        // The cache is process wide, so the second engine uses the
+        // directory of the first one.
+        final WebEngine second = loadPage(SECOND_USER_DATA_DIR);
+        assertEquals(expected, ((Number) submit(() -> second.executeScript("run()"))).intValue());
+        assertTrue("The second load did not use the cached bytecode",
+                submit(() -> WebPageShim.getBytecodeCacheRetrievedCount()) > retrievedCount);
+    }
+}
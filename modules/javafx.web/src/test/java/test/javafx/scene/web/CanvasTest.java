@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -121,6 +121,44 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasPathHitTesting() {
+        final String htmlCanvasPaths =
+                "<canvas id='canvas' width='200' height='200'></canvas> <script>" +
+                        "var context = document.getElementById('canvas').getContext('2d');" +
+                        "var curve = new Path2D();" +
+                        "curve.moveTo(20, 20);" +
+                        "curve.bezierCurveTo(180, 20, 180, 180, 20, 180);" +
+                        "curve.closePath();" +
+                        "var ring = new Path2D();" +
+                        "ring.arc(100, 100, 50, 0, 2 * Math.PI);" +
+                        "ring.moveTo(125, 100);" +
+                        "ring.arc(100, 100, 25, 0, 2 * Math.PI);" +
+                        "var moved = new Path2D();" +
+                        "moved.addPath(ring, { e: 50 });" +
+                        "context.fillStyle = 'red';" +
+                        "context.fill(moved);" +
+                        "function hit(path, x, y, rule) {" +
+                        "  return context.isPointInPath(path, x, y, rule);" +
+                        "} </script>";
+
+        loadContent(htmlCanvasPaths);
+        submit(() -> {
+            assertEquals(true, getEngine().executeScript("hit(curve, 100, 100)"));
+            assertEquals(true, getEngine().executeScript("hit(curve, 135, 100)"));
+            assertEquals(false, getEngine().executeScript("hit(curve, 170, 100)"));
+
+            assertEquals(true, getEngine().executeScript("hit(ring, 100, 100, 'nonzero')"));
+            assertEquals(false, getEngine().executeScript("hit(ring, 100, 100, 'evenodd')"));
+            assertEquals(true, getEngine().executeScript("hit(ring, 100, 60, 'evenodd')"));
+            assertEquals(false, getEngine().executeScript("hit(ring, 100, 40)"));
+
+            assertEquals(true, getEngine().executeScript("hit(moved, 150, 60)"));
+            assertEquals(false, getEngine().executeScript("hit(moved, 100, 60)"));
+            assertEquals("Transformed arc filled", 255,
+                    (int) getEngine().executeScript("context.getImageData(150, 60, 1, 1).data[0]"));
+        });
+    }
+
     // JDK-8234471
     @Test public void testCanvasPattern() throws Exception {
         final String htmlCanvasContent = "\n"
@@ -153,6 +191,42 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    @Test public void testCanvasRepeatedStateChanges() {
+        // Redundant fill colors are not encoded twice, make sure the
+        // state stack and the buffer boundaries are still respected.
+        final String htmlCanvasContent = "\n"
+            + "<canvas id='canvasstate' width='100' height='100'></canvas>\n"
+            + "<script>\n"
+            + "var ctx = document.getElementById('canvasstate').getContext('2d');\n"
+            + "ctx.fillStyle = 'red';\n"
+            + "ctx.save();\n"
+            + "ctx.fillStyle = 'blue';\n"
+            + "ctx.fillRect(0, 0, 10, 10);\n"
+            + "ctx.restore();\n"
+            + "ctx.fillStyle = 'red';\n"
+            + "ctx.fillRect(10, 0, 10, 10);\n"
+            + "for (var i = 0; i < 10000; i++) {\n"
+            + "    ctx.fillStyle = i % 2 ? 'red' : 'lime';\n"
+            + "    ctx.fillStyle = 'lime';\n"
+            + "    ctx.fillRect(0, 20, 10, 10);\n"
+            + "}\n"
+            + "</script>\n";
+
+        loadContent(htmlCanvasContent);
+        submit(() -> {
+            final String getPixel =
+                "document.getElementById('canvasstate').getContext('2d').getImageData(%d, %d, 1, 1).data[%d]";
+            assertEquals("Rect filled in the saved state", 255,
+                    (int) getEngine().executeScript(String.format(getPixel, 5, 5, 2)));
+            assertEquals("Rect filled after the restored state", 255,
+                    (int) getEngine().executeScript(String.format(getPixel, 15, 5, 0)));
+            assertEquals("Rect filled with repeated color", 255,
+                    (int) getEngine().executeScript(String.format(getPixel, 5, 25, 1)));
+            assertEquals("Rect filled with repeated color", 0,
+                    (int) getEngine().executeScript(String.format(getPixel, 5, 25, 0)));
+        });
+    }
+
     private BufferedImage htmlCanvasToBufferedImage(final String mime) throws Exception {
         ByteArrayOutputStream errStream = new ByteArrayOutputStream();
         System.setErr(new PrintStream(errStream));
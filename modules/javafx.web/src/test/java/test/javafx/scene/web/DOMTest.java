@@ -436,6 +436,50 @@ public class DOMTest extends TestBase {
         });
     }
 
+    @Test public void testSnapshot() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            Element p = doc.getElementById("empty-paragraph");
+            NodeSnapshot snapshot = ((NodeImpl) p.getParentNode()).snapshot(true);
+            assertEquals("Snapshot node name", "BODY", snapshot.getNodeName());
+            assertEquals("Snapshot children count",
+                    p.getParentNode().getChildNodes().getLength(),
+                    snapshot.getChildren().size());
+            assertTrue("Snapshot bounds", snapshot.hasBounds());
+
+            NodeSnapshot paragraph = ((NodeImpl) p).snapshot(false);
+            assertEquals("Snapshot node type", Node.ELEMENT_NODE, paragraph.getNodeType());
+            assertEquals("Snapshot attribute", "left", paragraph.getAttribute("align"));
+            assertNull("Snapshot parent", paragraph.getParent());
+            assertTrue("Snapshot children", paragraph.getChildren().isEmpty());
+        });
+    }
+
+    @Test public void testMutationBatch() {
+        final Document doc = getDocumentFor("src/test/resources/test/html/dom.html");
+        submit(() -> {
+            Element p = doc.getElementById("empty-paragraph");
+            Element span = doc.createElement("span");
+            new NodeMutationBatch()
+                    .setAttribute(p, "title", "batched")
+                    .removeAttribute(p, "align")
+                    .setTextContent(span, "text")
+                    .appendChild(p, span)
+                    .apply();
+            assertEquals("Attribute set", "batched", p.getAttribute("title"));
+            assertEquals("Attribute removed", "", p.getAttribute("align"));
+            assertEquals("Child appended", p, span.getParentNode());
+            assertEquals("Text content", "text", p.getTextContent());
+
+            try {
+                new NodeMutationBatch().appendChild(span, p).apply();
+                fail("DOMException expected but not thrown");
+            } catch (DOMException ex) {
+                // Expected.
+            }
+        });
+    }
+
     // helper methods
 
     private void verifyChildRemoved(Node parent,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@ package test.javafx.scene.web;
 
 import com.sun.webkit.WebPage;
 import com.sun.webkit.WebPageShim;
+import com.sun.webkit.graphics.RenderTheme;
 
 import java.io.ByteArrayOutputStream;
 import java.io.PrintStream;
@@ -110,6 +111,26 @@ public final class FormControlsTest extends TestBase {
         printWithFormControl(testBody);
     }
 
+    @Test
+    public void testWidgetCache() {
+        final Runnable testBody = () -> {
+            final WebPage page = WebEngineShim.getPage(getEngine());
+            assertNotNull(page);
+            WebPageShim.mockPrint(page, 0, 0, 800, 600);
+            final long hits = RenderTheme.getWidgetCacheHits();
+            final long misses = RenderTheme.getWidgetCacheMisses();
+            // An unchanged control is drawn with its cached widget.
+            WebPageShim.mockPrint(page, 0, 0, 800, 600);
+            assertTrue(String.format("%s widget wasn't reused", selector),
+                RenderTheme.getWidgetCacheHits() > hits);
+            assertEquals(String.format("%s widget was recreated", selector),
+                misses, RenderTheme.getWidgetCacheMisses());
+            assertEquals(1, getView().lookupAll("." + selector).size());
+        };
+
+        printWithFormControl(testBody);
+    }
+
     @Test
     public void testPrint() {
         final Runnable testBody = () -> {
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import com.sun.webkit.network.NetworkContext;
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.nio.charset.StandardCharsets;
+import java.security.MessageDigest;
+import java.util.HexFormat;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.atomic.AtomicInteger;
+import javafx.application.Platform;
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+public class HTTPDiskCacheTest extends TestBase {
+
+    private static final File CACHE_DIR = new File("build/httpcache");
+    private static final String ETAG = "\"v1\"";
+
+    private static ServerSocket serverSocket;
+    private static final Map<String, AtomicInteger> requestCounts = new ConcurrentHashMap<>();
+    private static final Map<String, AtomicInteger> notModifiedCounts = new ConcurrentHashMap<>();
+
+    private static void deleteRecursively(File file) throws IOException {
+        if (file.isDirectory()) {
+            for (File f : file.listFiles()) {
+                deleteRecursively(f);
+            }
+        }
+
+        if (file.exists() && !file.delete()) {
+            file.deleteOnExit();
+        }
+    }
+
+    @BeforeClass
+    public static void beforeClass() throws IOException {
+        deleteRecursively(CACHE_DIR);
+        System.setProperty("com.sun.webkit.httpCache.directory", CACHE_DIR.getAbsolutePath());
+
+        serverSocket = new ServerSocket(0, 50, InetAddress.getLoopbackAddress());
+        Thread serverThread = new Thread(() -> {
+            while (!serverSocket.isClosed()) {
+                try (Socket socket = serverSocket.accept()) {
+                    serve(socket);
+                } catch (IOException e) {
+                    // Closed by afterClass() or dropped by the client.
+                }
+            }
+        });
+        serverThread.setDaemon(true);
+        serverThread.start();
+    }
+
+    @AfterClass
+    public static void afterClass() throws Exception {
+        serverSocket.close();
+        System.clearProperty("com.sun.webkit.httpCache.directory");
+        // Disable the native cache for the test classes that follow.
+        FutureTask<Void> update = new FutureTask<>(NetworkContext::updateHTTPCacheConfiguration, null);
+        Platform.runLater(update);
+        update.get();
+        deleteRecursively(CACHE_DIR);
+    }
+
+    // Serves "/<name>.html" with the Cache-Control value named by the path.
+    // "/etag*" responses must be revalidated and carry an ETag.
+    private static void serve(Socket socket) throws IOException {
+        BufferedReader in = new BufferedReader(
+                new InputStreamReader(socket.getInputStream(), StandardCharsets.ISO_8859_1));
+        String requestLine = in.readLine();
+        if (requestLine == null) {
+            return;
+        }
+        String ifNoneMatch = null;
+        String line;
+        while ((line = in.readLine()) != null && !line.isEmpty()) {
+            if (line.regionMatches(true, 0, "If-None-Match:", 0, 14)) {
+                ifNoneMatch = line.substring(14).trim();
+            }
+        }
+        String path = requestLine.split(" ")[1];
+        requestCounts.computeIfAbsent(path, p -> new AtomicInteger()).incrementAndGet();
+
+        boolean etag = path.startsWith("/etag");
+        String cacheControl = path.startsWith("/no-store") ? "no-store"
+                : etag ? "no-cache" : "max-age=3600";
+        OutputStream out = socket.getOutputStream();
+        if (etag && ETAG.equals(ifNoneMatch)) {
+            notModifiedCounts.computeIfAbsent(path, p -> new AtomicInteger()).incrementAndGet();
+            out.write(("HTTP/1.1 304 Not Modified\r\n"
+                    + "ETag: " + ETAG + "\r\n"
+                    + "Cache-Control: " + cacheControl + "\r\n"
+                    + "Connection: close\r\n"
+                    + "\r\n").getBytes(StandardCharsets.ISO_8859_1));
+            out.flush();
+            return;
+        }
+
+        byte[] body = ("<html><body>" + path + "</body></html>").getBytes(StandardCharsets.ISO_8859_1);
+        String headers = "HTTP/1.1 200 OK\r\n"
+                + "Content-Type: text/html\r\n"
+                + "Content-Length: " + body.length + "\r\n"
+                + "Cache-Control: " + cacheControl + "\r\n"
+                + (etag ? "ETag: " + ETAG + "\r\n" : "")
+                + "Connection: close\r\n"
+                + "\r\n";
+        out.write(headers.getBytes(StandardCharsets.ISO_8859_1));
+        out.write(body);
+        out.flush();
+    }
+
+    private static String urlFor(String path) {
+        return "http://localhost:" + serverSocket.getLocalPort() + path;
+    }
+
+    private static int countCacheFiles() {
+        String[] names = CACHE_DIR.list((dir, name) -> name.endsWith(".headers") || name.endsWith(".body"));
+        return names == null ? 0 : names.length;
+    }
+
+    // Entries are written on a background queue after the load finishes.
+    private static int waitForCacheFiles(int count) throws InterruptedException {
+        for (int i = 0; i < 100 && countCacheFiles() < count; i++) {
+            Thread.sleep(50);
+        }
+        return countCacheFiles();
+    }
+
+    // The entry files are named by the SHA-1 of the URL.
+    private static File headersFile(String path) throws Exception {
+        byte[] digest = MessageDigest.getInstance("SHA-1")
+                .digest(urlFor(path).getBytes(StandardCharsets.UTF_8));
+        return new File(CACHE_DIR, HexFormat.of().withUpperCase().formatHex(digest) + ".headers");
+    }
+
+    // The headers are written after the body.
+    private static boolean waitForEntry(String path) throws Exception {
+        File headers = headersFile(path);
+        for (int i = 0; i < 100 && !headers.exists(); i++) {
+            Thread.sleep(50);
+        }
+        return headers.exists();
+    }
+
+    private String getBodyText() {
+        return (String) executeScript("document.body.textContent");
+    }
+
+    @Test public void testCacheableResponseIsStored() throws Exception {
+        int filesBefore = countCacheFiles();
+        load(urlFor("/cacheable.html"));
+        assertEquals("/cacheable.html", getBodyText());
+        assertEquals("Cache entry was not written", filesBefore + 2, waitForCacheFiles(filesBefore + 2));
+    }
+
+    @Test public void testNoStoreResponseIsNotStored() throws Exception {
+        load(urlFor("/no-store.html"));
+        assertEquals("/no-store.html", getBodyText());
+        // Entries are written in order, so a later cacheable load is written
+        // after the no-store one would be.
+        load(urlFor("/cacheable-after.html"));
+        assertTrue("Cache entry was not written", waitForEntry("/cacheable-after.html"));
+        assertFalse("no-store response was written to the cache",
+                headersFile("/no-store.html").exists());
+    }
+
+    @Test public void testFreshEntryIsUsed() throws Exception {
+        load(urlFor("/fresh.html"));
+        assertEquals("/fresh.html", getBodyText());
+        assertTrue("Cache entry was not written", waitForEntry("/fresh.html"));
+
+        load(urlFor("/other.html"));
+        load(urlFor("/fresh.html"));
+        assertEquals("/fresh.html", getBodyText());
+        assertEquals("Fresh entry was loaded from the network",
+                1, requestCounts.get("/fresh.html").get());
+    }
+
+    @Test public void testStaleEntryIsRevalidated() throws Exception {
+        load(urlFor("/etag.html"));
+        assertEquals("/etag.html", getBodyText());
+        assertTrue("Cache entry was not written", waitForEntry("/etag.html"));
+
+        load(urlFor("/other.html"));
+        load(urlFor("/etag.html"));
+        assertEquals("/etag.html", getBodyText());
+        assertEquals("Entry was not revalidated", 2, requestCounts.get("/etag.html").get());
+        assertEquals("Revalidation was not conditional", 1, notModifiedCounts.get("/etag.html").get());
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.webkit.prism.WCImageDecoderImplShim;
+import java.awt.Color;
+import java.awt.Graphics2D;
+import java.awt.image.BufferedImage;
+import java.io.ByteArrayOutputStream;
+import java.util.Base64;
+import javax.imageio.ImageIO;
+import org.junit.Before;
+import org.junit.Test;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+public class ImageDecodingTest extends TestBase {
+
+    // Large enough for WebCore to decode it asynchronously and, being over
+    // the 5 MP ImageSource allows before subsampling, to subsample it when
+    // drawn scaled down.
+    private static final int IMAGE_SIZE = 2560;
+
+    private static final String PIXEL =
+        "(function(c, x, y) {"
+        + "  var d = c.getContext('2d').getImageData(x, y, 1, 1).data;"
+        + "  return d[0] + ',' + d[1] + ',' + d[2];"
+        + "})";
+
+    @Before
+    public void before() throws Exception {
+        // Left half red, right half blue.
+        BufferedImage image = new BufferedImage(IMAGE_SIZE, IMAGE_SIZE, BufferedImage.TYPE_INT_RGB);
+        Graphics2D g = image.createGraphics();
+        g.setColor(Color.RED);
+        g.fillRect(0, 0, IMAGE_SIZE / 2, IMAGE_SIZE);
+        g.setColor(Color.BLUE);
+        g.fillRect(IMAGE_SIZE / 2, 0, IMAGE_SIZE / 2, IMAGE_SIZE);
+        g.dispose();
+        ByteArrayOutputStream out = new ByteArrayOutputStream();
+        ImageIO.write(image, "png", out);
+        String dataURL = "data:image/png;base64,"
+                + Base64.getEncoder().encodeToString(out.toByteArray());
+
+        loadContent(
+            "<img id='img' decoding='async' style='width:64px;height:64px'>\n"
+            + "<script>\n"
+            + "var state = '';\n"
+            + "function draw(size) {\n"
+            + "  var c = document.createElement('canvas');\n"
+            + "  c.width = c.height = size;\n"
+            + "  c.getContext('2d').drawImage(document.getElementById('img'), 0, 0, size, size);\n"
+            + "  return c;\n"
+            + "}\n"
+            + "function decode() {\n"
+            + "  document.getElementById('img').decode()\n"
+            + "    .then(() => state = 'decoded', e => state = 'failed: ' + e);\n"
+            + "}\n"
+            + "document.getElementById('img').src = '" + dataURL + "';\n"
+            + "</script>\n");
+    }
+
+    @Test
+    public void testAsyncDecode() {
+        executeScript("decode()");
+        assertEquals("decoded", waitForState());
+        assertEquals(IMAGE_SIZE, ((Number) executeScript(
+                "document.getElementById('img').naturalWidth")).intValue());
+    }
+
+    @Test
+    public void testSubsampledDraw() {
+        executeScript("decode()");
+        assertEquals("decoded", waitForState());
+
+        // Drawn at 1/8 of its size, the image comes from a subsampled frame.
+        int small = IMAGE_SIZE / 8;
+        executeScript("var small = draw(" + small + ")");
+        int width = WCImageDecoderImplShim.getLastSubsampledWidth();
+        assertTrue("image was not subsampled: " + width, width > 0 && width < IMAGE_SIZE);
+        assertEquals("255,0,0", executeScript(PIXEL + "(small, 16, " + small / 2 + ")"));
+        assertEquals("0,0,255", executeScript(PIXEL + "(small, " + (small - 16) + ", " + small / 2 + ")"));
+
+        // The full size frame must still be available afterwards.
+        executeScript("var large = draw(" + IMAGE_SIZE + ")");
+        assertEquals("255,0,0", executeScript(PIXEL + "(large, 16, " + IMAGE_SIZE / 2 + ")"));
+        assertEquals("0,0,255", executeScript(PIXEL + "(large, " + (IMAGE_SIZE - 24) + ", " + IMAGE_SIZE / 2 + ")"));
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import org.junit.AfterClass;
+import org.junit.BeforeClass;
+import org.junit.Test;
+import java.io.File;
+import java.io.IOException;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import javafx.concurrent.Worker.State;
+import javafx.scene.web.WebEngine;
+
+public class IndexedDBTest extends TestBase {
+
+    private static final File USER_DATA_DIR = new File("build/indexeddb");
+    private static final File FIRST_USER_DATA_DIR = new File("build/indexeddb-first");
+    private static final File SECOND_USER_DATA_DIR = new File("build/indexeddb-second");
+    private static final File PAGE = new File("src/test/resources/test/html/indexeddb.html");
+
+    private static void deleteRecursively(File file) throws IOException {
+        if (file.isDirectory()) {
+            for (File f : file.listFiles()) {
+                deleteRecursively(f);
+            }
+        }
+
+        if (file.exists() && !file.delete()) {
+            // If WebKit takes time to close the file, better
+            // delete it during VM shutdown.
+            file.deleteOnExit();
+        }
+    }
+
+    private static boolean containsDatabase(File file) {
+        if (file.isDirectory()) {
+            for (File f : file.listFiles()) {
+                if (containsDatabase(f)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        return file.getName().equals("IndexedDB.sqlite3");
+    }
+
+    @BeforeClass
+    public static void beforeClass() throws IOException {
+        deleteRecursively(USER_DATA_DIR);
+        deleteRecursively(FIRST_USER_DATA_DIR);
+        deleteRecursively(SECOND_USER_DATA_DIR);
+    }
+
+    @AfterClass
+    public static void afterClass() throws IOException {
+        deleteRecursively(USER_DATA_DIR);
+        deleteRecursively(FIRST_USER_DATA_DIR);
+        deleteRecursively(SECOND_USER_DATA_DIR);
+    }
+
+    private WebEngine createEngine(File userDataDir) throws InterruptedException {
+        final CountDownLatch loaded = new CountDownLatch(1);
+        final WebEngine webEngine = submit(() -> {
+            WebEngine engine = new WebEngine();
+            engine.setUserDataDirectory(userDataDir);
+            engine.getLoadWorker().stateProperty().addListener((observable, oldValue, newValue) -> {
+                if (newValue == State.SUCCEEDED) {
+                    loaded.countDown();
+                }
+            });
+            engine.load(PAGE.toURI().toString());
+            return engine;
+        });
+        assertTrue("Timeout loading " + PAGE, loaded.await(10, TimeUnit.SECONDS));
+        return webEngine;
+    }
+
+    @Test
+    public void testDatabaseIsStoredInUserDataDirectory() throws Exception {
+        final WebEngine webEngine = getEngine();
+        submit(() -> webEngine.setUserDataDirectory(USER_DATA_DIR));
+        load(PAGE);
+
+        executeScript("store_record('key', 'value')");
+        assertEquals("stored", waitForState());
+        assertTrue("No database in " + USER_DATA_DIR,
+                containsDatabase(new File(USER_DATA_DIR, "indexeddb")));
+
+        executeScript("load_record('key')");
+        assertEquals("loaded", waitForState());
+        assertEquals("value", executeScript("result"));
+    }
+
+    // IndexedDB requests of pages with different user data directories
+    // must not end up in the same directory.
+    @Test
+    public void testEnginesUseTheirOwnDirectories() throws Exception {
+        final WebEngine first = createEngine(FIRST_USER_DATA_DIR);
+        final WebEngine second = createEngine(SECOND_USER_DATA_DIR);
+
+        submit(() -> first.executeScript("store_record('key', 'first')"));
+        assertEquals("stored", waitForState(first));
+        submit(() -> second.executeScript("store_record('key', 'second')"));
+        assertEquals("stored", waitForState(second));
+
+        assertTrue("No database in " + FIRST_USER_DATA_DIR,
+                containsDatabase(new File(FIRST_USER_DATA_DIR, "indexeddb")));
+        assertTrue("No database in " + SECOND_USER_DATA_DIR,
+                containsDatabase(new File(SECOND_USER_DATA_DIR, "indexeddb")));
+
+        submit(() -> first.executeScript("load_record('key')"));
+        assertEquals("loaded", waitForState(first));
+        assertEquals("first", submit(() -> first.executeScript("result")));
+        submit(() -> second.executeScript("load_record('key')"));
+        assertEquals("loaded", waitForState(second));
+        assertEquals("second", submit(() -> second.executeScript("result")));
+    }
+}
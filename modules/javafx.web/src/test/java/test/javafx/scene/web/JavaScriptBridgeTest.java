@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -316,6 +316,52 @@ public class JavaScriptBridgeTest extends TestBase {
         });
     }
 
+    public static class Accumulator {
+        private double sum;
+        private int count;
+
+        public void add(int i, double d, boolean b) {
+            sum += b ? i + d : 0;
+            count++;
+        }
+
+        public double addAndGet(double d) {
+            sum += d;
+            return sum;
+        }
+
+        public String label(String prefix, int n) {
+            return prefix + n;
+        }
+
+        public int getCount() {
+            return count;
+        }
+    }
+
+    // Repeated calls from JavaScript to the same Java methods must keep
+    // dispatching to the right method with the right arguments.
+    public @Test void testMethodCallLoop() {
+        final WebEngine web = getEngine();
+        final int calls = 20000;
+
+        submit(() -> {
+            Accumulator acc = new Accumulator();
+            bind("acc", acc);
+            Object result = web.executeScript(
+                    "var s, l;"
+                    + "for (var i = 0; i < " + calls + "; i++) {"
+                    + "  acc.add(i, 0.5, true);"
+                    + "  s = acc.addAndGet(-0.5);"
+                    + "  l = acc.label('n', i);"
+                    + "}"
+                    + "l + ':' + s");
+
+            assertEquals("n" + (calls - 1) + ":" + (long) calls * (calls - 1) / 2, result);
+            assertEquals(calls, acc.getCount());
+        });
+    }
+
     // JDK-8141386
     public static class WrapperObjects {
         public Number n0; // using setter
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.file.Files;
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Test;
+
+/**
+ * Tests that the position reported by an audio element, which WebKit
+ * extrapolates from the updates sent by the media player, follows the
+ * playback clock.
+ */
+public class MediaCurrentTimeTest extends TestBase {
+
+    private static final File DIR = new File("build/mediatime");
+    private static final int SAMPLE_RATE = 8000;
+    private static final int DURATION = 10; // seconds
+
+    // Largest accepted difference between the reported and the expected
+    // position, in seconds.
+    private static final double TOLERANCE = 0.3;
+
+    @Before
+    public void before() throws IOException {
+        DIR.mkdirs();
+        writeWave(new File(DIR, "tone.wav"));
+        File page = new File(DIR, "audio.html");
+        Files.writeString(page.toPath(),
+            "<audio id='a' src='tone.wav' preload='auto'></audio>\n"
+            + "<script>\n"
+            + "var state = '';\n"
+            + "var a = document.getElementById('a');\n"
+            + "a.oncanplaythrough = () => { if (!state) state = 'ready'; };\n"
+            + "a.onerror = () => state = 'error';\n"
+            + "var c0, t0;\n"
+            + "function mark() { c0 = a.currentTime; t0 = performance.now(); }\n"
+            + "function drift() {\n"
+            + "  return (a.currentTime - c0) - a.playbackRate * (performance.now() - t0) / 1000;\n"
+            + "}\n"
+            + "</script>\n");
+        load(page);
+        // Media playback may not be available, e.g. without an audio device.
+        assumeTrue("ready".equals(waitForState()));
+    }
+
+    @After
+    public void after() {
+        executeScript("a.pause()");
+    }
+
+    // 16-bit mono PCM, 440 Hz.
+    private static void writeWave(File file) throws IOException {
+        int dataSize = SAMPLE_RATE * DURATION * 2;
+        ByteBuffer buffer = ByteBuffer.allocate(44 + dataSize).order(ByteOrder.LITTLE_ENDIAN);
+        buffer.put("RIFF".getBytes()).putInt(36 + dataSize).put("WAVE".getBytes());
+        buffer.put("fmt ".getBytes()).putInt(16).putShort((short) 1).putShort((short) 1)
+              .putInt(SAMPLE_RATE).putInt(SAMPLE_RATE * 2).putShort((short) 2).putShort((short) 16);
+        buffer.put("data".getBytes()).putInt(dataSize);
+        for (int i = 0; i < SAMPLE_RATE * DURATION; i++) {
+            buffer.putShort((short) (Math.sin(2 * Math.PI * 440 * i / SAMPLE_RATE) * 8000));
+        }
+        Files.write(file.toPath(), buffer.array());
+    }
+
+    private double getDouble(String script) {
+        return ((Number) executeScript(script)).doubleValue();
+    }
+
+    // Lets playback run for a second and checks that the position advanced
+    // at the playback rate, as the player's clock does.
+    private void assertAdvancing() throws InterruptedException {
+        executeScript("mark()");
+        Thread.sleep(1000);
+        assertTrue("currentTime did not advance", getDouble("a.currentTime - c0") > 0.5);
+        assertEquals(0, getDouble("drift()"), TOLERANCE);
+    }
+
+    @Test
+    public void testCurrentTime() throws Exception {
+        executeScript("state = ''; a.play().then(() => state = 'playing', e => state = 'failed: ' + e)");
+        assertEquals("playing", waitForState());
+        assertAdvancing();
+
+        executeScript("state = ''; a.onseeked = () => state = 'seeked'; a.currentTime = 4");
+        assertEquals("seeked", waitForState());
+        assertEquals(4, getDouble("a.currentTime"), TOLERANCE);
+        assertAdvancing();
+
+        executeScript("a.playbackRate = 2");
+        assertEquals(2, getDouble("a.playbackRate"), 0);
+        assertAdvancing();
+    }
+}
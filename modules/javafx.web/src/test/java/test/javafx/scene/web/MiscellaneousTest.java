@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -367,6 +367,42 @@ public class MiscellaneousTest extends TestBase {
         });
     }
 
+    /**
+     * Measures text that the primary font has no glyphs for. Such glyphs
+     * come from a fallback slot of the composite font and their codes carry
+     * the slot number in the high bits.
+     */
+    @Test public void testFallbackFontGlyphWidths() {
+        final String[] samples = {
+            "中", // CJK
+            "가", // Hangul
+            "क", // Devanagari
+            "א", // Hebrew
+        };
+        StringBuilder html = new StringBuilder("<body style='font-family: serif; font-size: 20px'>");
+        for (int i = 0; i < samples.length; i++) {
+            html.append("<span id='one").append(i).append("'>").append(samples[i]).append("</span><br>")
+                .append("<span id='ten").append(i).append("'>").append(samples[i].repeat(10)).append("</span><br>");
+        }
+        html.append("<span id='latin'>Lorem ipsum</span></body>");
+        loadContent(html.toString());
+
+        submit(() -> {
+            for (int i = 0; i < samples.length; i++) {
+                final double one = getWidth("one" + i);
+                final double ten = getWidth("ten" + i);
+                assertTrue("Glyph width of " + samples[i] + " is not positive: " + one, one > 0);
+                assertEquals("Glyph widths of " + samples[i] + " don't add up", 10 * one, ten, 1.0);
+            }
+            assertTrue(getWidth("latin") > 0);
+        });
+    }
+
+    private double getWidth(String id) {
+        return ((Number) getEngine().executeScript(
+                "document.getElementById('" + id + "').getBoundingClientRect().width")).doubleValue();
+    }
+
     /**
      * @test
      * @bug 8185132
@@ -484,6 +520,31 @@ public class MiscellaneousTest extends TestBase {
         });
     }
 
+    @Test public void testComplexTextRelayout() {
+        // Arabic and Latin words in one string are shaped into several runs
+        // of different directions. Shaped runs are cached per font, so the
+        // same string has to lay out the same way in every layout, and
+        // differently with a different font.
+        loadContent(
+            "<span id='a' style='font-size:20px'>\u0645\u0631\u062d\u0628\u0627 hello \u0628\u0643</span><br>\n" +
+            "<span id='b' style='font-size:20px'>\u0645\u0631\u062d\u0628\u0627 hello \u0628\u0643</span><br>\n" +
+            "<span id='c' style='font-size:40px'>\u0645\u0631\u062d\u0628\u0627 hello \u0628\u0643</span>\n"
+        );
+        submit(() -> {
+            final String width = "document.getElementById('%s').getBoundingClientRect().width";
+            final double a = ((Number) getEngine().executeScript(String.format(width, "a"))).doubleValue();
+            final double b = ((Number) getEngine().executeScript(String.format(width, "b"))).doubleValue();
+            final double c = ((Number) getEngine().executeScript(String.format(width, "c"))).doubleValue();
+            assertTrue("Complex text has a width", a > 0);
+            assertEquals("Same text, same font", a, b, 0.01);
+            assertTrue("Same text, larger font", c > a * 1.5);
+
+            getEngine().executeScript("document.getElementById('a').style.fontSize = '40px'");
+            final double a2 = ((Number) getEngine().executeScript(String.format(width, "a"))).doubleValue();
+            assertEquals("Relayout with the larger font", c, a2, 0.01);
+        });
+    }
+
     @Test public void jrtCssFileIsNotRejected() {
         submit(() -> {
             try {
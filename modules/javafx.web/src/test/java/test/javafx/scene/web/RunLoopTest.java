@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.Assert.assertArrayEquals;
+import com.sun.webkit.WebPageShim;
+import org.junit.Test;
+
+/**
+ * Tests that timers and observers of the native main RunLoop, which the
+ * FX event loop drives, fire on the FX thread.
+ */
+public class RunLoopTest extends TestBase {
+
+    private static final int REPEAT_COUNT = 3;
+
+    @Test
+    public void testTimersAndObserverFire() throws Exception {
+        submit(() -> WebPageShim.startRunLoopTest(REPEAT_COUNT));
+
+        int[] expected = { 1, REPEAT_COUNT, 1, 1 };
+        int[] results = null;
+        for (int i = 0; i < 100; i++) {
+            results = submit(WebPageShim::getRunLoopTestResults);
+            if (results[1] >= REPEAT_COUNT && results[0] > 0 && results[2] > 0) {
+                break;
+            }
+            Thread.sleep(50);
+        }
+        // The repeating timer was rescheduled until it stopped itself.
+        Thread.sleep(100);
+        results = submit(WebPageShim::getRunLoopTestResults);
+        assertArrayEquals("{one-shot, repeating, observer, on FX thread}", expected, results);
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assume.assumeTrue;
+import java.io.File;
+import org.junit.Before;
+import org.junit.Test;
+
+public class SubtleCryptoTest extends TestBase {
+
+    @Before
+    public void before() {
+        // SubtleCrypto needs a secure context, which a file URL is.
+        load(new File("src/test/resources/test/html/subtlecrypto.html"));
+        // SubtleCrypto is only built in when OpenSSL is enabled.
+        assumeTrue((Boolean) executeScript("typeof crypto.subtle !== 'undefined'"));
+    }
+
+    @Test
+    public void testDigest() {
+        executeScript("digest('SHA-1', 'abc')");
+        assertEquals("a9993e364706816aba3e25717850c26c9cd0d89d", waitForState());
+        executeScript("digest('SHA-256', 'abc')");
+        assertEquals("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", waitForState());
+        executeScript("digest('SHA-384', '')");
+        assertEquals("38b060a751ac96384cd9327eb1b1e36a21fdb71114be0743"
+                + "4c0cc7bf63f6e1da274edebfe76f65fbd51ad2f14898b95b", waitForState());
+        executeScript("digest('SHA-512', 'abc')");
+        assertEquals("ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+                + "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f", waitForState());
+    }
+
+    @Test
+    public void testHMAC() {
+        executeScript("hmac()");
+        assertEquals("true", waitForState());
+    }
+
+    @Test
+    public void testAES() {
+        executeScript("aes_gcm()");
+        assertEquals("The quick brown fox jumps over the lazy dog", waitForState());
+        executeScript("aes_cbc()");
+        assertEquals("The quick brown fox jumps over the lazy dog", waitForState());
+    }
+
+    @Test
+    public void testSignatures() {
+        executeScript("ecdsa()");
+        assertEquals("true,false", waitForState());
+        executeScript("rsa_pss()");
+        assertEquals("true,false", waitForState());
+    }
+}
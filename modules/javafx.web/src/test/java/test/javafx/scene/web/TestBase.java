@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -217,6 +217,35 @@ public class TestBase implements ChangeListener, InvalidationListener {
         return submit(() -> getEngine().executeScript(script));
     }
 
+    /**
+     * Waits until a script of the page sets the global {@code state}
+     * variable to a non-empty string, and returns it. Used for operations
+     * that complete on FX thread after the script that started them has
+     * returned. Returns "timeout" if the state is not set in 5 seconds.
+     */
+    protected String waitForState(WebEngine engine) {
+        for (int i = 0; i < 100; i++) {
+            String state = submit(() -> (String) engine.executeScript("state"));
+            if (!state.isEmpty()) {
+                return state;
+            }
+            try {
+                Thread.sleep(50);
+            } catch (InterruptedException e) {
+                throw new AssertionError(e);
+            }
+        }
+        return "timeout";
+    }
+
+    /**
+     * Waits for the {@code state} of the page loaded by the WebEngine
+     * under test, see {@link #waitForState(WebEngine)}.
+     */
+    protected String waitForState() {
+        return waitForState(getEngine());
+    }
+
     private class LoadFinishedListener implements ChangeListener<Boolean> {
         @Override
         public void changed(ObservableValue<? extends Boolean> observable,
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.PlatformUtil;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assume.assumeTrue;
+import org.junit.Before;
+import org.junit.Test;
+
+public class WebAssemblyTest extends TestBase {
+
+    // (module (func (export "add") (param i32 i32) (result i32)
+    //     local.get 0 local.get 1 i32.add))
+    private static final String ADD_MODULE =
+            "new Uint8Array([0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00," +
+            " 0x01, 0x07, 0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f," +
+            " 0x03, 0x02, 0x01, 0x00," +
+            " 0x07, 0x07, 0x01, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00," +
+            " 0x0a, 0x09, 0x01, 0x07, 0x00, 0x20, 0x00, 0x20, 0x01, 0x6a, 0x0b])";
+
+    // (module (memory 1) (func (export "load") (param i32) (result i32)
+    //     local.get 0 i32.load))
+    private static final String LOAD_MODULE =
+            "new Uint8Array([0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00," +
+            " 0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f," +
+            " 0x03, 0x02, 0x01, 0x00," +
+            " 0x05, 0x03, 0x01, 0x00, 0x01," +
+            " 0x07, 0x08, 0x01, 0x04, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x00," +
+            " 0x0a, 0x09, 0x01, 0x07, 0x00, 0x20, 0x00, 0x28, 0x02, 0x00, 0x0b])";
+
+    @Before
+    public void before() {
+        // WebAssembly is only enabled on Linux x86-64
+        assumeTrue(PlatformUtil.isLinux() && "amd64".equals(System.getProperty("os.arch")));
+        loadContent("<html></html>");
+    }
+
+    @Test public void testInstantiate() {
+        assertEquals("object", executeScript("typeof WebAssembly"));
+        assertEquals(Boolean.TRUE, executeScript("WebAssembly.validate(" + ADD_MODULE + ")"));
+        assertEquals(Boolean.FALSE, executeScript("WebAssembly.validate(new Uint8Array([0, 1, 2, 3]))"));
+        assertEquals(5, executeScript(
+                "new WebAssembly.Instance(new WebAssembly.Module(" + ADD_MODULE + ")).exports.add(2, 3)"));
+    }
+
+    @Test public void testTierUp() {
+        // Run long enough for the function to leave the interpreter.
+        assertEquals(1000000, executeScript(
+                "(function() {" +
+                "    const add = new WebAssembly.Instance(new WebAssembly.Module(" + ADD_MODULE + ")).exports.add;" +
+                "    let sum = 0;" +
+                "    for (let i = 0; i < 1000000; ++i)" +
+                "        sum = add(sum, 1);" +
+                "    return sum;" +
+                "})()"));
+    }
+
+    @Test public void testOutOfBoundsLoad() {
+        assertEquals("0:RuntimeError", executeScript(
+                "(function() {" +
+                "    const load = new WebAssembly.Instance(new WebAssembly.Module(" + LOAD_MODULE + ")).exports.load;" +
+                "    try {" +
+                "        load(65536);" +
+                "        return 'no trap';" +
+                "    } catch (e) {" +
+                "        return load(65532) + ':' + e.constructor.name;" +
+                "    }" +
+                "})()"));
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures the throughput of crypto.subtle.digest over a large buffer,
+ * 100 MB by default, for each SHA variant. The digests complete
+ * asynchronously, so like {@link IndexedDBBenchmark} the iterations are
+ * timed by the page, which reports each algorithm through an alert.
+ *
+ * SubtleCrypto is only available to secure contexts, so the page is
+ * loaded from a temporary file.
+ */
+public class DigestBenchmark extends Application {
+
+    private static final int WARMUP_ITERATIONS =
+            Integer.getInteger("warmup", 2);
+    private static final int ITERATIONS =
+            Integer.getInteger("iterations", 10);
+    private static final int SIZE =
+            Integer.getInteger("size", 100 * 1024 * 1024);
+
+    private static String createContent() {
+        return "<html><body><script>"
+                + "var data = new Uint8Array(" + SIZE + ");"
+                + "for (var i = 0; i < data.length; i++) data[i] = i * 31 & 0xFF;"
+                + "var algorithms = ['SHA-1', 'SHA-256', 'SHA-384', 'SHA-512'];"
+                + "function repeat(algorithm, count, done) {"
+                + "  var t0 = performance.now();"
+                + "  var i = 0;"
+                + "  function next() {"
+                + "    if (i++ == count) { done(performance.now() - t0); return; }"
+                + "    crypto.subtle.digest(algorithm, data).then(next, function(e) { alert('error ' + e); });"
+                + "  }"
+                + "  next();"
+                + "}"
+                + "function measure(k) {"
+                + "  if (k == algorithms.length) { alert('done'); return; }"
+                + "  repeat(algorithms[k], " + WARMUP_ITERATIONS + ", function() {"
+                + "    repeat(algorithms[k], " + ITERATIONS + ", function(time) {"
+                + "      alert(algorithms[k] + ': ' + (data.length * " + ITERATIONS + " / 1048576 / time * 1000).toFixed(1) + ' MB/s');"
+                + "      measure(k + 1);"
+                + "    });"
+                + "  });"
+                + "}"
+                + "measure(0);"
+                + "</script></body></html>";
+    }
+
+    @Override
+    public void start(Stage stage) throws IOException {
+        File dir = Files.createTempDirectory("webview-digest").toFile();
+        File page = new File(dir, "benchmark.html");
+        Files.write(page.toPath(), createContent().getBytes(StandardCharsets.UTF_8));
+        page.deleteOnExit();
+        dir.deleteOnExit();
+
+        WebView webView = new WebView();
+        stage.setScene(new Scene(webView, 1024, 768));
+        stage.show();
+
+        WebEngine engine = webView.getEngine();
+        engine.setOnAlert(event -> {
+            if (event.getData().equals("done")) {
+                Platform.exit();
+                return;
+            }
+            System.out.printf("%s: %d iterations of %d bytes, %s\n",
+                    getClass().getSimpleName(), ITERATIONS, SIZE, event.getData());
+            if (event.getData().startsWith("error")) {
+                Platform.exit();
+            }
+        });
+        engine.load(page.toURI().toString());
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures IndexedDB put, get and cursor throughput against the on-disk
+ * backing store. IndexedDB is asynchronous, so unlike the other benchmarks
+ * the iterations are driven and timed by the page itself, which reports
+ * each phase through an alert.
+ *
+ * The databases are kept in a fresh user data directory, which is removed
+ * at exit.
+ */
+public class IndexedDBBenchmark extends Application {
+
+    private static final int WARMUP_ITERATIONS =
+            Integer.getInteger("warmup", 5);
+    private static final int ITERATIONS =
+            Integer.getInteger("iterations", 20);
+    private static final int RECORDS =
+            Integer.getInteger("records", 10000);
+
+    private static String createContent() {
+        return "<html><body><script>"
+                + "var records = " + RECORDS + ";"
+                + "var totals = { put: 0, get: 0, cursor: 0 };"
+                + "function value(i) {"
+                + "  return { id: i, name: 'record ' + i, tags: ['a', 'b', 'c'], payload: 'x'.repeat(200) };"
+                + "}"
+                + "function phase(db, mode, body, done) {"
+                + "  var t0 = performance.now();"
+                + "  var transaction = db.transaction('records', mode);"
+                + "  body(transaction.objectStore('records'));"
+                + "  transaction.oncomplete = function() { done(performance.now() - t0); };"
+                + "  transaction.onerror = function() { alert('error ' + transaction.error); };"
+                + "}"
+                + "function iteration(db, i, count, measure) {"
+                + "  if (i == count) { measure(); return; }"
+                + "  phase(db, 'readwrite', function(store) {"
+                + "    for (var k = 0; k < records; k++) store.put(value(k), k);"
+                + "  }, function(put) {"
+                + "    phase(db, 'readonly', function(store) {"
+                + "      for (var k = 0; k < records; k++) store.get(k);"
+                + "    }, function(get) {"
+                + "      phase(db, 'readonly', function(store) {"
+                + "        store.openCursor().onsuccess = function(e) {"
+                + "          var cursor = e.target.result;"
+                + "          if (cursor) cursor.continue();"
+                + "        };"
+                + "      }, function(cursor) {"
+                + "        totals.put += put; totals.get += get; totals.cursor += cursor;"
+                + "        iteration(db, i + 1, count, measure);"
+                + "      });"
+                + "    });"
+                + "  });"
+                + "}"
+                + "function report(count) {"
+                + "  for (var name in totals) {"
+                + "    alert(name + ': ' + (records * count / totals[name] * 1000).toFixed(0) + ' records/s');"
+                + "  }"
+                + "}"
+                + "var request = indexedDB.open('benchmark', 1);"
+                + "request.onupgradeneeded = function() { request.result.createObjectStore('records'); };"
+                + "request.onsuccess = function() {"
+                + "  var db = request.result;"
+                + "  iteration(db, 0, " + WARMUP_ITERATIONS + ", function() {"
+                + "    totals = { put: 0, get: 0, cursor: 0 };"
+                + "    iteration(db, 0, " + ITERATIONS + ", function() {"
+                + "      report(" + ITERATIONS + ");"
+                + "      alert('done');"
+                + "    });"
+                + "  });"
+                + "};"
+                + "request.onerror = function() { alert('error ' + request.error); };"
+                + "</script></body></html>";
+    }
+
+    @Override
+    public void start(Stage stage) throws IOException {
+        File userDataDir = Files.createTempDirectory("webview-idb").toFile();
+        File page = new File(userDataDir, "benchmark.html");
+        Files.write(page.toPath(), createContent().getBytes(StandardCharsets.UTF_8));
+        Runtime.getRuntime().addShutdownHook(new Thread(() -> deleteRecursively(userDataDir)));
+
+        WebView webView = new WebView();
+        stage.setScene(new Scene(webView, 1024, 768));
+        stage.show();
+
+        WebEngine engine = webView.getEngine();
+        engine.setUserDataDirectory(new File(userDataDir, "data"));
+        engine.setOnAlert(event -> {
+            if (event.getData().equals("done")) {
+                Platform.exit();
+                return;
+            }
+            System.out.printf("%s: %d iterations of %d records, %s\n",
+                    getClass().getSimpleName(), ITERATIONS, RECORDS, event.getData());
+            if (event.getData().startsWith("error")) {
+                Platform.exit();
+            }
+        });
+        // IndexedDB is not available to pages without an origin, so the
+        // page is loaded from a file.
+        engine.load(page.toURI().toString());
+    }
+
+    private static void deleteRecursively(File file) {
+        File[] children = file.listFiles();
+        if (children != null) {
+            for (File child : children) {
+                deleteRecursively(child);
+            }
+        }
+        file.delete();
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webview;
+
+import javafx.scene.web.WebEngine;
+import netscape.javascript.JSObject;
+
+/**
+ * Calls the same methods of a bound Java object from a JavaScript loop:
+ * every iteration makes {@code calls} round trips each to a void method
+ * with mixed primitive arguments, a method returning a double and a
+ * method returning a String.
+ */
+public class JavaCallBenchmark extends WebViewBenchmark {
+
+    private static final int WARMUP_ITERATIONS = Integer.getInteger("warmup", 5);
+    private static final int CALLS = Integer.getInteger("calls", 20000);
+
+    private Accumulator accumulator;
+    private long measuredNanos;
+    private int measuredIterations;
+
+    public static class Accumulator {
+        private double sum;
+
+        public void add(int i, double d, boolean b) {
+            sum += b ? i + d : 0;
+        }
+
+        public double addAndGet(double d) {
+            sum += d;
+            return sum;
+        }
+
+        public String label(String prefix, int n) {
+            return prefix + n;
+        }
+    }
+
+    @Override
+    protected String createContent() {
+        return "<html><body><script>"
+                + "function iteration(calls) {"
+                + "  var s, l;"
+                + "  for (var i = 0; i < calls; i++) {"
+                + "    acc.add(i, 0.5, true);"
+                + "    s = acc.addAndGet(-0.5);"
+                + "    l = acc.label('n', i);"
+                + "  }"
+                + "  return l;"
+                + "}"
+                + "</script></body></html>";
+    }
+
+    @Override
+    protected void run(WebEngine engine, int iteration) {
+        if (accumulator == null) {
+            accumulator = new Accumulator();
+            JSObject window = (JSObject) engine.executeScript("window");
+            window.setMember("acc", accumulator);
+        }
+        long start = System.nanoTime();
+        engine.executeScript("iteration(" + CALLS + ")");
+        if (iteration >= WARMUP_ITERATIONS) {
+            measuredNanos += System.nanoTime() - start;
+            measuredIterations++;
+        }
+    }
+
+    @Override
+    protected void report(WebEngine engine) {
+        if (measuredIterations > 0) {
+            System.out.printf("%.1f ns per call\n",
+                    (double) measuredNanos / (3L * CALLS * measuredIterations));
+        }
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import javafx.scene.web.WebEngine;
+
+/**
+ * Runs a small JetStream-style set of CPU-bound JavaScript workloads
+ * modelled on data-heavy pages: sorting and filtering a data grid,
+ * client-side aggregation, JSON round trips, floating point simulation
+ * and polymorphic object dispatch. Besides the overall time, the mean
+ * time of each workload over the measured iterations is printed.
+ *
+ * To compare JIT tiers, run it once with {@code -Dcom.sun.webkit.useDFGJIT=true
+ * -Dcom.sun.webkit.useFTLJIT=false} and once with both set to {@code true}.
+ */
+public class JavaScriptBenchmark extends WebViewBenchmark {
+
+    private static final int WARMUP_ITERATIONS = Integer.getInteger("warmup", 5);
+    private static final int ROWS = Integer.getInteger("rows", 20000);
+
+    @Override
+    protected String createContent() {
+        return "<html><body><script>"
+                + "var rows = [];"
+                + "for (var i = 0; i < " + ROWS + "; i++) {"
+                + "  rows.push({ id: i, region: 'region' + (i * 7919 % 13), product: 'product' + (i * 104729 % 97),"
+                + "              quantity: i * 31 % 50 + 1, price: (i * 17 % 1000) / 10 + 0.99 });"
+                + "}"
+                + "function gridSort() {"
+                + "  var copy = rows.slice();"
+                + "  copy.sort(function(a, b) {"
+                + "    if (a.region != b.region) return a.region < b.region ? -1 : 1;"
+                + "    if (a.price != b.price) return b.price - a.price;"
+                + "    return a.id - b.id;"
+                + "  });"
+                + "  var visible = copy.filter(function(r) { return r.quantity > 10; });"
+                + "  return visible.length + copy[0].id;"
+                + "}"
+                + "function aggregate() {"
+                + "  var groups = new Map();"
+                + "  for (var k = 0; k < rows.length; k++) {"
+                + "    var r = rows[k];"
+                + "    var key = r.region + '/' + r.product;"
+                + "    var g = groups.get(key);"
+                + "    if (!g) { g = { count: 0, total: 0, max: 0 }; groups.set(key, g); }"
+                + "    var amount = r.quantity * r.price;"
+                + "    g.count++; g.total += amount; if (amount > g.max) g.max = amount;"
+                + "  }"
+                + "  var sum = 0;"
+                + "  groups.forEach(function(g) { sum += g.total / g.count; });"
+                + "  return sum;"
+                + "}"
+                + "function json() {"
+                + "  return JSON.parse(JSON.stringify(rows.slice(0, 5000))).length;"
+                + "}"
+                + "function nbody() {"
+                + "  var n = 64, x = new Float64Array(n), y = new Float64Array(n),"
+                + "      vx = new Float64Array(n), vy = new Float64Array(n);"
+                + "  for (var i = 0; i < n; i++) { x[i] = Math.cos(i); y[i] = Math.sin(i); }"
+                + "  for (var step = 0; step < 100; step++) {"
+                + "    for (var i = 0; i < n; i++) {"
+                + "      for (var j = i + 1; j < n; j++) {"
+                + "        var dx = x[j] - x[i], dy = y[j] - y[i];"
+                + "        var d2 = dx * dx + dy * dy + 0.01, f = 0.001 / (d2 * Math.sqrt(d2));"
+                + "        vx[i] += dx * f; vy[i] += dy * f; vx[j] -= dx * f; vy[j] -= dy * f;"
+                + "      }"
+                + "    }"
+                + "    for (var i = 0; i < n; i++) { x[i] += vx[i]; y[i] += vy[i]; }"
+                + "  }"
+                + "  return x[0] + y[0];"
+                + "}"
+                + "class Shape { area() { return 0; } }"
+                + "class Circle extends Shape { constructor(r) { super(); this.r = r; } area() { return 3.14159 * this.r * this.r; } }"
+                + "class Rect extends Shape { constructor(w, h) { super(); this.w = w; this.h = h; } area() { return this.w * this.h; } }"
+                + "class Tri extends Shape { constructor(b, h) { super(); this.b = b; this.h = h; } area() { return this.b * this.h / 2; } }"
+                + "var shapes = [];"
+                + "for (var i = 0; i < 3000; i++) shapes.push(i % 3 == 0 ? new Circle(i % 7) : i % 3 == 1 ? new Rect(i % 5, i % 11) : new Tri(i % 13, i % 3));"
+                + "function dispatch() {"
+                + "  var total = 0;"
+                + "  for (var k = 0; k < 100; k++)"
+                + "    for (var i = 0; i < shapes.length; i++) total += shapes[i].area();"
+                + "  return total;"
+                + "}"
+                + "var workloads = { gridSort: gridSort, aggregate: aggregate, json: json, nbody: nbody, dispatch: dispatch };"
+                + "var times = {};"
+                + "var measured = 0;"
+                + "function runAll(measure) {"
+                + "  for (var name in workloads) {"
+                + "    var t0 = performance.now();"
+                + "    workloads[name]();"
+                + "    if (measure) times[name] = (times[name] || 0) + performance.now() - t0;"
+                + "  }"
+                + "  if (measure) measured++;"
+                + "}"
+                + "function report() {"
+                + "  var lines = [];"
+                + "  for (var name in times) lines.push(name + ': ' + (times[name] / measured).toFixed(3) + 'ms');"
+                + "  return lines.join('\\n');"
+                + "}"
+                + "</script></body></html>";
+    }
+
+    @Override
+    protected void run(WebEngine engine, int iteration) {
+        engine.executeScript("runAll(" + (iteration >= WARMUP_ITERATIONS) + ")");
+    }
+
+    @Override
+    protected void report(WebEngine engine) {
+        System.out.println(engine.executeScript("report()"));
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import javafx.scene.web.WebEngine;
+
+/**
+ * Matches selectors against a large, class heavy document: every
+ * iteration runs a set of querySelectorAll() calls and then restyles the
+ * whole document by toggling a class on its root.
+ *
+ * Where the CSS selector JIT is enabled, the interpreted SelectorChecker
+ * can be measured for comparison by running the benchmark again with
+ * {@code -Dcom.sun.webkit.useJIT=false}, which disables the selector
+ * compiler along with the JavaScript JIT. Setting {@code JSC_useJIT} in
+ * the environment has no effect, as the page overrides it with the
+ * value of that property.
+ */
+public class StyleRecalcBenchmark extends WebViewBenchmark {
+
+    private static final int NODES = Integer.getInteger("nodes", 20000);
+
+    private static final String[] SELECTORS = {
+        ".list .item.active > .label",
+        "div.card:not(.hidden) span.tag",
+        ".row:nth-child(2n+1) .cell.c3",
+        "[data-kind=\"b\"] .label",
+        ".grid .row .cell .label.em",
+        ".card ~ .card .tag:first-child",
+    };
+
+    @Override
+    protected String createContent() {
+        StringBuilder sb = new StringBuilder("<html><head><style>");
+        for (String selector : SELECTORS) {
+            sb.append(selector).append(" { color: #123456; }\n");
+            sb.append(".alt ").append(selector).append(" { color: #654321; }\n");
+        }
+        for (int i = 0; i < 50; i++) {
+            sb.append(".c").append(i).append(" .label { margin-left: ")
+              .append(i % 7).append("px; }\n");
+        }
+        sb.append("</style></head><body><div id='root' class='grid list'>");
+
+        // Each row has ten nodes.
+        for (int r = 0; r < NODES / 10; r++) {
+            sb.append("<div class='row card").append(r % 5 == 0 ? " hidden" : "")
+              .append("' data-kind='").append((char) ('a' + r % 3)).append("'>");
+            for (int c = 0; c < 3; c++) {
+                sb.append("<div class='cell item c").append(c).append(r % 4 == c ? " active" : "")
+                  .append("'><span class='label").append((r + c) % 3 == 0 ? " em" : "")
+                  .append("'>").append(r).append("</span><span class='tag'>t</span></div>");
+            }
+            sb.append("</div>");
+        }
+        sb.append("</div><script>"
+                + "var queryTime = 0, restyleTime = 0, matches = 0;"
+                + "var selectors = ").append(toJSArray(SELECTORS)).append(";"
+                + "function iteration() {"
+                + "  var t0 = performance.now();"
+                + "  for (var i = 0; i < selectors.length; i++)"
+                + "    matches += document.querySelectorAll(selectors[i]).length;"
+                + "  var t1 = performance.now();"
+                + "  document.getElementById('root').classList.toggle('alt');"
+                + "  document.body.offsetHeight;"
+                + "  var t2 = performance.now();"
+                + "  queryTime += t1 - t0;"
+                + "  restyleTime += t2 - t1;"
+                + "}"
+                + "</script></body></html>");
+        return sb.toString();
+    }
+
+    private static String toJSArray(String[] strings) {
+        StringBuilder sb = new StringBuilder("[");
+        for (String s : strings) {
+            sb.append('\'').append(s).append("',");
+        }
+        return sb.append(']').toString();
+    }
+
+    @Override
+    protected void run(WebEngine engine, int iteration) {
+        engine.executeScript("iteration()");
+    }
+
+    @Override
+    protected void report(WebEngine engine) {
+        // Includes the warmup iterations.
+        System.out.printf("querySelectorAll: %.3fms, restyle: %.3fms, %s matches\n",
+                ((Number) engine.executeScript("queryTime")).doubleValue(),
+                ((Number) engine.executeScript("restyleTime")).doubleValue(),
+                engine.executeScript("matches"));
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
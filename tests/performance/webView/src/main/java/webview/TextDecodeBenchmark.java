@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package webview;
+
+import javafx.scene.web.WebEngine;
+
+/**
+ * Decodes byte corpora in the encodings served by the native codecs
+ * (UTF-8, windows-1252 and UTF-16LE) with the TextDecoder API, which goes
+ * through the same WebCore codecs as HTML and script decoding. Each corpus
+ * mixes long ASCII runs with non-ASCII text, so that both the ASCII fast
+ * path and the slow path are exercised.
+ */
+public class TextDecodeBenchmark extends WebViewBenchmark {
+
+    private static final int CORPUS_SIZE = Integer.getInteger("corpusSize", 4 * 1024 * 1024);
+
+    @Override
+    protected String createContent() {
+        return "<html><body><script>"
+                + "var size = " + CORPUS_SIZE + ";"
+                + "function utf8(ascii, other) {"
+                + "  var a = new Uint8Array(size);"
+                + "  for (var i = 0; i < size;) {"
+                + "    for (var j = 0; j < ascii && i < size; j++) a[i++] = 0x61 + j % 26;"
+                + "    for (var j = 0; j < other && i + 3 <= size; j++) {"
+                + "      a[i++] = 0xE6; a[i++] = 0x96; a[i++] = 0x87;"
+                + "    }"
+                + "    if (i < size) a[i++] = 0x20;"
+                + "  }"
+                + "  return a;"
+                + "}"
+                + "function latin1() {"
+                + "  var a = new Uint8Array(size);"
+                + "  for (var i = 0; i < size; i++) a[i] = i % 97 ? 0x61 + i % 26 : 0xE9;"
+                + "  return a;"
+                + "}"
+                + "function utf16() {"
+                + "  var a = new Uint8Array(size);"
+                + "  for (var i = 0; i < size; i += 2) {"
+                + "    var c = i % 194 ? 0x61 + i % 26 : 0x0416;"
+                + "    a[i] = c & 0xFF; a[i + 1] = c >> 8;"
+                + "  }"
+                + "  return a;"
+                + "}"
+                + "var corpora = ["
+                + "  ['utf-8', utf8(4096, 0)],"
+                + "  ['utf-8', utf8(200, 8)],"
+                + "  ['utf-8', utf8(2, 16)],"
+                + "  ['windows-1252', latin1()],"
+                + "  ['utf-16le', utf16()]"
+                + "];"
+                + "function decodeAll() {"
+                + "  var length = 0;"
+                + "  for (var k = 0; k < corpora.length; k++)"
+                + "    length += new TextDecoder(corpora[k][0]).decode(corpora[k][1]).length;"
+                + "  return length;"
+                + "}"
+                + "</script></body></html>";
+    }
+
+    @Override
+    protected void run(WebEngine engine, int iteration) {
+        engine.executeScript("decodeAll()");
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import javafx.scene.web.WebEngine;
+
+/**
+ * Lays out a large text document. Every iteration uses a new font size,
+ * so that the glyph metrics are requested from the platform fonts again.
+ * With the perf loggers enabled, the GETGLYPHWIDTHS and GETGLYPHCODES
+ * counters divided by the number of iterations give the JNI crossings
+ * per layout.
+ */
+public class TextLayoutBenchmark extends WebViewBenchmark {
+
+    private static final int PARAGRAPHS = Integer.getInteger("paragraphs", 2000);
+
+    private static final String[] WORDS = {
+        "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing",
+        "elit", "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore",
+        "et", "dolore", "magna", "aliqua", "Ut", "enim", "ad", "minim", "veniam",
+        "0123456789", "\u00C0\u00C9\u00CE\u00D5\u00DC", "\u00E0\u00E9\u00EE\u00F5\u00FC",
+        "\u0100\u0112\u012A\u014C\u016A", "\u0391\u0392\u0393\u0394\u0395",
+        "\u0410\u0411\u0412\u0413\u0414"
+    };
+
+    @Override
+    protected String createContent() {
+        StringBuilder sb = new StringBuilder("<html><body style='font-family:serif'>");
+        for (int p = 0; p < PARAGRAPHS; p++) {
+            sb.append("<p>");
+            for (int w = 0; w < 60; w++) {
+                sb.append(WORDS[(p * 7 + w * 13) % WORDS.length]).append(' ');
+            }
+            sb.append("</p>");
+        }
+        return sb.append("</body></html>").toString();
+    }
+
+    @Override
+    protected void run(WebEngine engine, int iteration) {
+        engine.executeScript("document.body.style.fontSize = '"
+                + (10 + iteration * 0.25) + "px';"
+                + "document.body.offsetHeight;");
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
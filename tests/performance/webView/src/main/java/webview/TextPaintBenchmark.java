@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package webview;
+
+import java.lang.management.ManagementFactory;
+import javafx.scene.web.WebEngine;
+
+/**
+ * Paints a text-dense document. Every iteration scrolls the page and
+ * takes a snapshot of the WebView, so that the visible text runs are
+ * painted into the render queue again. The bytes allocated on the
+ * JavaFX application thread per paint are printed at the end; they
+ * include the glyph and advance arrays if the render queue passes them
+ * as Java objects.
+ */
+public class TextPaintBenchmark extends WebViewBenchmark {
+
+    private static final int PARAGRAPHS = Integer.getInteger("paragraphs", 500);
+    private static final int WARMUP_ITERATIONS = Integer.getInteger("warmup", 5);
+
+    private static final com.sun.management.ThreadMXBean threadBean =
+            (com.sun.management.ThreadMXBean) ManagementFactory.getThreadMXBean();
+
+    private long allocatedBytes;
+    private int paints;
+
+    @Override
+    protected String createContent() {
+        StringBuilder sb = new StringBuilder("<html><body style='font-size:10px'>");
+        for (int p = 0; p < PARAGRAPHS; p++) {
+            sb.append("<p>");
+            for (int w = 0; w < 80; w++) {
+                // Alternate styles so that every few words start a new text run.
+                sb.append(w % 5 == 0 ? "<b>" : "").append("word").append(p + w)
+                  .append(w % 5 == 0 ? "</b> " : " ");
+            }
+            sb.append("</p>");
+        }
+        return sb.append("</body></html>").toString();
+    }
+
+    @Override
+    protected void run(WebEngine engine, int iteration) {
+        engine.executeScript("window.scrollTo(0, " + (iteration % 10) * 400 + ")");
+        long before = threadBean.getThreadAllocatedBytes(Thread.currentThread().getId());
+        getWebView().snapshot(null, null);
+        long after = threadBean.getThreadAllocatedBytes(Thread.currentThread().getId());
+        if (iteration >= WARMUP_ITERATIONS) {
+            allocatedBytes += after - before;
+            paints++;
+        }
+    }
+
+    @Override
+    protected void report(WebEngine engine) {
+        System.out.printf("%s: %d bytes allocated per paint on the FX thread\n",
+                getClass().getSimpleName(), allocatedBytes / paints);
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
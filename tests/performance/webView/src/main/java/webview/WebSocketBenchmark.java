@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.net.InetAddress;
+import java.net.ServerSocket;
+import java.net.Socket;
+import java.nio.charset.StandardCharsets;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.Base64;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Measures WebSocket message throughput against an echo server on the
+ * loopback interface. The page keeps a window of messages in flight and
+ * sends a new one for every echo it receives, so both the send and the
+ * receive path of the socket stream are exercised. Like
+ * {@link IndexedDBBenchmark}, the page times itself and reports the
+ * result through an alert.
+ */
+public class WebSocketBenchmark extends Application {
+
+    private static final int WARMUP_MESSAGES =
+            Integer.getInteger("warmup", 20000);
+    private static final int MESSAGES =
+            Integer.getInteger("messages", 200000);
+    private static final int MESSAGE_SIZE =
+            Integer.getInteger("messageSize", 64);
+    private static final int WINDOW =
+            Integer.getInteger("window", 64);
+
+    private static String createContent(int port) {
+        return "<html><body><script>"
+                + "var message = 'x'.repeat(" + MESSAGE_SIZE + ");"
+                + "var ws = new WebSocket('ws://127.0.0.1:" + port + "/');"
+                + "function run(count, done) {"
+                + "  var sent = 0, received = 0, t0 = performance.now();"
+                + "  ws.onmessage = function() {"
+                + "    if (++received == count) { done(performance.now() - t0); return; }"
+                + "    if (sent < count) { ws.send(message); sent++; }"
+                + "  };"
+                + "  for (; sent < Math.min(" + WINDOW + ", count); sent++) ws.send(message);"
+                + "}"
+                + "ws.onopen = function() {"
+                + "  run(" + WARMUP_MESSAGES + ", function() {"
+                + "    run(" + MESSAGES + ", function(time) {"
+                + "      alert((" + MESSAGES + " / time * 1000).toFixed(0) + ' messages/s');"
+                + "      ws.close();"
+                + "      alert('done');"
+                + "    });"
+                + "  });"
+                + "};"
+                + "ws.onerror = function() { alert('error'); };"
+                + "</script></body></html>";
+    }
+
+    @Override
+    public void start(Stage stage) throws IOException {
+        ServerSocket server = new ServerSocket(0, 1, InetAddress.getLoopbackAddress());
+        Thread echo = new Thread(() -> {
+            try (Socket socket = server.accept()) {
+                socket.setTcpNoDelay(true);
+                echo(socket);
+            } catch (IOException ex) {
+                ex.printStackTrace();
+            }
+        }, "WebSocketBenchmark-echo");
+        echo.setDaemon(true);
+        echo.start();
+
+        WebView webView = new WebView();
+        stage.setScene(new Scene(webView, 1024, 768));
+        stage.show();
+
+        WebEngine engine = webView.getEngine();
+        engine.setOnAlert(event -> {
+            if (event.getData().equals("done")) {
+                Platform.exit();
+                return;
+            }
+            System.out.printf("%s: %d messages of %d bytes, window %d, %s\n",
+                    getClass().getSimpleName(), MESSAGES, MESSAGE_SIZE, WINDOW, event.getData());
+            if (event.getData().startsWith("error")) {
+                Platform.exit();
+            }
+        });
+        engine.loadContent(createContent(server.getLocalPort()));
+    }
+
+    // A minimal RFC 6455 echo server, only as complete as the page needs.
+    private static void echo(Socket socket) throws IOException {
+        DataInputStream in = new DataInputStream(new BufferedInputStream(socket.getInputStream()));
+        OutputStream out = new BufferedOutputStream(socket.getOutputStream());
+
+        String key = null;
+        for (String line = readLine(in); !line.isEmpty(); line = readLine(in)) {
+            if (line.regionMatches(true, 0, "Sec-WebSocket-Key:", 0, 18)) {
+                key = line.substring(18).trim();
+            }
+        }
+        out.write(("HTTP/1.1 101 Switching Protocols\r\n"
+                + "Upgrade: websocket\r\n"
+                + "Connection: Upgrade\r\n"
+                + "Sec-WebSocket-Accept: " + accept(key) + "\r\n\r\n")
+                .getBytes(StandardCharsets.US_ASCII));
+        out.flush();
+
+        byte[] payload = new byte[0];
+        byte[] mask = new byte[4];
+        while (true) {
+            int opcode = in.readUnsignedByte() & 0x0F;
+            int length = in.readUnsignedByte() & 0x7F;
+            if (length == 126) {
+                length = in.readUnsignedShort();
+            } else if (length == 127) {
+                length = (int) in.readLong();
+            }
+            in.readFully(mask);
+            if (payload.length < length) {
+                payload = new byte[length];
+            }
+            in.readFully(payload, 0, length);
+            for (int i = 0; i < length; i++) {
+                payload[i] ^= mask[i & 3];
+            }
+
+            out.write(0x80 | opcode);
+            if (length < 126) {
+                out.write(length);
+            } else if (length < 65536) {
+                out.write(126);
+                out.write(length >> 8);
+                out.write(length);
+            } else {
+                out.write(127);
+                for (int shift = 56; shift >= 0; shift -= 8) {
+                    out.write((int) ((long) length >> shift));
+                }
+            }
+            out.write(payload, 0, length);
+            if (opcode == 0x8) {
+                out.flush();
+                return;
+            }
+            if (in.available() == 0) {
+                out.flush();
+            }
+        }
+    }
+
+    private static String readLine(InputStream in) throws IOException {
+        StringBuilder sb = new StringBuilder();
+        for (int c = in.read(); c != '\n'; c = in.read()) {
+            if (c < 0) {
+                throw new IOException("Unexpected end of handshake");
+            }
+            if (c != '\r') {
+                sb.append((char) c);
+            }
+        }
+        return sb.toString();
+    }
+
+    private static String accept(String key) throws IOException {
+        try {
+            MessageDigest sha1 = MessageDigest.getInstance("SHA-1");
+            byte[] digest = sha1.digest((key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11")
+                    .getBytes(StandardCharsets.US_ASCII));
+            return Base64.getEncoder().encodeToString(digest);
+        } catch (NoSuchAlgorithmException ex) {
+            throw new IOException(ex);
+        }
+    }
+
+    public static void main(String[] args) {
+        launch(args);
+    }
+}
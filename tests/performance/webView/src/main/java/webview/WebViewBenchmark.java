@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package webview;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * Base class of the WebView benchmarks. Loads the content returned by
+ * {@link #createContent()} and, once it is loaded, calls {@link #run}
+ * for the given number of warmup and measured iterations on the
+ * JavaFX application thread.
+ *
+ * The JNI crossings made by the web engine can be counted by enabling
+ * the perf loggers, e.g. by setting the {@code com.sun.webkit.perf.level}
+ * logging property to {@code FINE}. The counters are printed at exit.
+ */
+public abstract class WebViewBenchmark extends Application {
+
+    private static final int WARMUP_ITERATIONS =
+            Integer.getInteger("warmup", 5);
+    private static final int ITERATIONS =
+            Integer.getInteger("iterations", 20);
+
+    private WebView webView;
+
+    protected abstract String createContent();
+
+    protected abstract void run(WebEngine engine, int iteration);
+
+    /**
+     * Called after the measured iterations, to print any additional
+     * results collected by the benchmark.
+     */
+    protected void report(WebEngine engine) {
+    }
+
+    protected WebView getWebView() {
+        return webView;
+    }
+
+    @Override
+    public void start(Stage stage) {
+        webView = new WebView();
+        stage.setScene(new Scene(webView, 1024, 768));
+        stage.show();
+
+        WebEngine engine = webView.getEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                measure(engine);
+                Platform.exit();
+            }
+        });
+        engine.loadContent(createContent());
+    }
+
+    private void measure(WebEngine engine) {
+        for (int i = 0; i < WARMUP_ITERATIONS; i++) {
+            run(engine, i);
+        }
+
+        long t0 = System.nanoTime();
+        for (int i = 0; i < ITERATIONS; i++) {
+            run(engine, WARMUP_ITERATIONS + i);
+        }
+        long t1 = System.nanoTime();
+
+        System.out.printf("%s: %d iterations, %.3fms per iteration\n",
+                getClass().getSimpleName(), ITERATIONS,
+                (t1 - t0) / 1e6 / ITERATIONS);
+        report(engine);
+    }
+}